@@ -10,12 +10,78 @@
 #define JSONHPP_HPP__1E85F87A_AD28_4BF2_9739_184AF09C9524
 
 #include <array>
+#include <cstring>
+#include <cstdlib>
+#include <algorithm>
 #include <vector>
 #include <string>
+#include <limits>
 #include <variant>
+#include <type_traits>
 #include <iostream>
 #include <charconv>
 #include <memory_resource>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <exception>
+#include <new>
+#include <functional>
+#include <condition_variable>
+#include <filesystem>
+#include <fstream>
+#include <system_error>
+#include <unordered_map>
+
+#if !defined( JSONHPP_NO_SIMD )
+#	if defined( __AVX2__ )
+#		define JSONHPP_AVX2
+#	endif
+#	if defined( __SSSE3__ ) || defined( __AVX__ )
+#		define JSONHPP_SSSE3
+#	endif
+#	if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+#		define JSONHPP_SSE2
+#	endif
+#endif
+
+#if !defined( JSONHPP_NO_MMAP ) && ( defined( __unix__ ) || defined( __APPLE__ ) )
+#	define JSONHPP_MMAP
+#endif
+
+#if defined( __cpp_exceptions ) || defined( __EXCEPTIONS ) || defined( _CPPUNWIND )
+#	define JSONHPP_EXCEPTIONS
+#endif
+
+#if defined( JSONHPP_EXCEPTIONS )
+#	define JSONHPP_THROW( e ) throw e
+#else
+#	define JSONHPP_THROW( e ) std::abort()
+#endif
+
+#if !defined( JSONHPP_MAX_DEPTH )
+#	define JSONHPP_MAX_DEPTH 1024
+#endif
+
+#if !defined( JSONHPP_OBJECT_INDEX_THRESHOLD )
+#	define JSONHPP_OBJECT_INDEX_THRESHOLD 32
+#endif
+
+#if defined( JSONHPP_SSE2 ) || defined( JSONHPP_AVX2 )
+#include <immintrin.h>
+#endif
+
+#if defined( _MSC_VER )
+#include <intrin.h>
+#endif
+
+#if defined( JSONHPP_MMAP )
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
 
 namespace jsonhpp
 {
@@ -30,17 +96,76 @@ namespace jsonhpp
 		unknown,
 	};
 
+	enum class error
+	{
+		none,
+		unexpected_end,
+		unexpected_character,
+		trailing_characters,
+		invalid_number,
+		invalid_string,
+		invalid_escape,
+		invalid_unicode,
+		invalid_utf8,
+		depth_exceeded,
+		buffer_too_small,
+		out_of_memory,
+		unknown,
+	};
+
+	struct result
+	{
+		jsonhpp::error error = jsonhpp::error::none;
+		std::size_t position = 0;
+
+		explicit operator bool() const
+		{
+			return error == jsonhpp::error::none;
+		}
+
+		const char * what() const
+		{
+			switch ( error )
+			{
+			case jsonhpp::error::none: return "no error";
+			case jsonhpp::error::unexpected_end: return "unexpected end!";
+			case jsonhpp::error::unexpected_character: return "unknown character";
+			case jsonhpp::error::trailing_characters: return "trailing characters!";
+			case jsonhpp::error::invalid_number: return "invalid number!";
+			case jsonhpp::error::invalid_string: return "control character in string!";
+			case jsonhpp::error::invalid_escape: return "invalid escape!";
+			case jsonhpp::error::invalid_unicode: return "unpaired surrogate!";
+			case jsonhpp::error::invalid_utf8: return "invalid utf-8!";
+			case jsonhpp::error::depth_exceeded: return "nesting too deep!";
+			case jsonhpp::error::buffer_too_small: return "out of range";
+			case jsonhpp::error::out_of_memory: return "out of memory!";
+			case jsonhpp::error::unknown: return "unknown error";
+			}
+			return "unknown error";
+		}
+	};
+
 	class value;
+	class key_pool;
 	template< jsonhpp::type T > class element;
 	template< typename T > class istream_wrapper;
 	template< typename T > class ostream_wrapper;
 
-	template< typename T > value __read_value( std::pmr::memory_resource * resource, ostream_wrapper< T > & stream );
-	template< typename T > void __write_value( const value & val, istream_wrapper< T > & stream, std::uint32_t depth, std::uint32_t tab );
+	struct __read_frame
+	{
+		element< jsonhpp::type::array > * array;
+		element< jsonhpp::type::object > * object;
+	};
+	// containers still open during a parse; reusing one across reads keeps its capacity
+	using read_stack = std::vector< __read_frame >;
+
+	template< typename T > value __read_value( std::pmr::memory_resource * resource, istream_wrapper< T > & stream, read_stack & stack, std::uint32_t max_depth = JSONHPP_MAX_DEPTH, key_pool * pool = nullptr );
+	template< typename T > value __read_value( std::pmr::memory_resource * resource, istream_wrapper< T > & stream, std::uint32_t max_depth = JSONHPP_MAX_DEPTH, key_pool * pool = nullptr );
+	template< typename T > void __write_value( const value & val, ostream_wrapper< T > & stream, std::uint32_t depth, std::uint32_t tab, bool ascii );
 	element< jsonhpp::type::array > * __make_array( std::pmr::memory_resource * resource, const std::initializer_list< value > & list );
 	element< jsonhpp::type::object > * __make_object( std::pmr::memory_resource * resource, const std::initializer_list< value > & list );
-	element< jsonhpp::type::array > * __copy_array( std::pmr::memory_resource * resource, element< jsonhpp::type::array > * copy );
-	element< jsonhpp::type::object > * __copy_object( std::pmr::memory_resource * resource, element< jsonhpp::type::object > * copy );
+	element< jsonhpp::type::array > * __copy_array( std::pmr::memory_resource * resource, element< jsonhpp::type::array > * copy, std::vector< std::pair< const value *, value * > > & pending );
+	element< jsonhpp::type::object > * __copy_object( std::pmr::memory_resource * resource, element< jsonhpp::type::object > * copy, std::vector< std::pair< const value *, value * > > & pending );
 
 
 	template< typename ... T > struct overloaded : T... { using T::operator()...; };
@@ -52,27 +177,58 @@ namespace jsonhpp
 		using string_type = const char *;
 
 	public:
-		istream_wrapper( string_type str, std::size_t size )
-			:_str( str ), _size( size ), _pos( 0 )
+		istream_wrapper( string_type str, std::size_t size, bool insitu = false )
+			:_str( str ), _buf( nullptr ), _size( size ), _pos( 0 ), _insitu( insitu )
+		{}
+
+		istream_wrapper( char * str, std::size_t size, bool insitu = false )
+			:_str( str ), _buf( insitu ? str : nullptr ), _size( size ), _pos( 0 ), _insitu( insitu )
 		{}
 
 	public:
 		inline char get()
 		{
-			if ( _pos >= _size ) throw std::out_of_range( "out of range" );
+			if ( _pos >= _size ) JSONHPP_THROW( std::out_of_range( "out of range" ) );
 
 			return _str[_pos++];
 		}
 
 		inline char peek() const
 		{
-			return _str[_pos];
+			return _pos < _size ? _str[_pos] : '\0';
+		}
+
+		inline const char * data() const
+		{
+			return _str + _pos;
+		}
+
+		inline std::size_t remain() const
+		{
+			return _size - _pos;
+		}
+
+		inline void skip( std::size_t n )
+		{
+			_pos += n;
+		}
+
+		inline bool insitu() const
+		{
+			return _insitu;
+		}
+
+		inline char * mutable_data() const
+		{
+			return _buf != nullptr ? _buf + _pos : nullptr;
 		}
 
 	private:
-		std::size_t _pos;
 		string_type _str;
+		char * _buf;
 		std::size_t _size;
+		std::size_t _pos;
+		bool _insitu;
 	};
 	template<> class ostream_wrapper< char * >
 	{
@@ -87,9 +243,16 @@ namespace jsonhpp
 	public:
 		inline void put( char c )
 		{
-			if ( _pos >= _size ) throw std::out_of_range( "out of range" );
+			if ( _pos < _size ) _str[_pos] = c;
+
+			++_pos;
+		}
+
+		inline void write( const char * s, std::size_t n )
+		{
+			if ( _pos < _size ) std::memcpy( _str + _pos, s, std::min( n, _size - _pos ) );
 
-			_str[_pos++] = c;
+			_pos += n;
 		}
 
 		inline std::size_t size() const
@@ -97,34 +260,133 @@ namespace jsonhpp
 			return _pos;
 		}
 
+		inline bool overflow() const
+		{
+			return _pos > _size;
+		}
+
+		// only the first failure is kept, with the output position it happened at
+		inline void fail( jsonhpp::error error )
+		{
+			if ( _status ) _status = { error, _pos };
+		}
+
+		inline const jsonhpp::result & status() const
+		{
+			return _status;
+		}
+
 	private:
 		std::size_t _pos;
 		string_type _str;
 		std::size_t _size;
+		jsonhpp::result _status;
 	};
 	template<> class istream_wrapper< std::basic_istream< char, std::char_traits< char > > >
 	{
 	public:
 		using string_type = std::basic_istream< char, std::char_traits< char > >;
+		using traits_type = std::char_traits< char >;
 
 	public:
-		istream_wrapper( string_type & str )
-			:_str( str )
+		istream_wrapper( string_type & str, std::size_t size = 64 * 1024 )
+			:_str( str ), _buf( std::max< std::size_t >( size, 1 ) ), _pos( 0 ), _end( 0 )
 		{}
 
+		istream_wrapper( const istream_wrapper & ) = delete;
+
+		istream_wrapper & operator= ( const istream_wrapper & ) = delete;
+
+		~istream_wrapper()
+		{
+			release();
+		}
+
 	public:
 		inline char get()
 		{
-			return _str.get();
+			if ( _pos == _end && !fill() ) JSONHPP_THROW( std::out_of_range( "out of range" ) );
+
+			return _buf[_pos++];
 		}
 
-		inline char peek() const
+		inline char peek()
+		{
+			if ( _pos == _end && !fill() ) return '\0';
+
+			return _buf[_pos];
+		}
+
+		inline const char * data() const
 		{
-			return _str.peek();
+			return _buf.data() + _pos;
+		}
+
+		inline std::size_t remain()
+		{
+			if ( _pos == _end ) fill();
+
+			return _end - _pos;
+		}
+
+		inline void skip( std::size_t n )
+		{
+			_pos += n;
+		}
+
+		void release()
+		{
+			std::size_t n = _end - _pos;
+			if ( n == 0 ) return;
+
+			auto buf = _str.rdbuf();
+			if ( buf->pubseekoff( -std::streamoff( n ), std::ios_base::cur, std::ios_base::in ) == std::streampos( std::streamoff( -1 ) ) )
+			{
+				for ( ; n != 0; --n )
+				{
+					if ( traits_type::eq_int_type( buf->sputbackc( _buf[_pos + n - 1] ), traits_type::eof() ) ) break;
+				}
+
+				if ( n != 0 ) _str.setstate( std::ios_base::failbit );
+			}
+
+			_pos = _end = 0;
+		}
+
+	private:
+		bool fill()
+		{
+			_pos = _end = 0;
+
+			auto buf = _str.rdbuf();
+			if ( buf == nullptr || !_str.good() ) return false;
+
+			std::streamsize avail = buf->in_avail();
+			if ( avail == 0 )
+			{
+				auto c = buf->sbumpc();
+				if ( !traits_type::eq_int_type( c, traits_type::eof() ) )
+				{
+					_buf[_end++] = traits_type::to_char_type( c );
+					avail = buf->in_avail();
+				}
+			}
+
+			if ( avail > 0 && _end < _buf.size() )
+			{
+				_end += static_cast< std::size_t >( buf->sgetn( _buf.data() + _end, std::min< std::streamsize >( avail, _buf.size() - _end ) ) );
+			}
+
+			if ( _end == 0 ) _str.setstate( std::ios_base::eofbit );
+
+			return _end != 0;
 		}
 
 	private:
 		string_type & _str;
+		std::vector< char > _buf;
+		std::size_t _pos;
+		std::size_t _end;
 	};
 	template<> class ostream_wrapper< std::basic_ostream< char, std::char_traits< char > > >
 	{
@@ -132,23 +394,66 @@ namespace jsonhpp
 		using string_type = std::basic_ostream< char, std::char_traits< char > >;
 
 	public:
-		ostream_wrapper( string_type & str )
-			:_str( str )
+		ostream_wrapper( string_type & str, std::size_t size = 64 * 1024 )
+			:_str( str ), _buf( std::max< std::size_t >( size, 1 ) ), _pos( 0 ), _written( 0 )
 		{}
 
+		ostream_wrapper( const ostream_wrapper & ) = delete;
+
+		ostream_wrapper & operator= ( const ostream_wrapper & ) = delete;
+
+		~ostream_wrapper()
+		{
+			flush();
+		}
+
 	public:
 		inline void put( char c )
 		{
-			_str.put( c );
+			if ( _pos == _buf.size() ) flush();
+
+			_buf[_pos++] = c;
+		}
+
+		inline void write( const char * s, std::size_t n )
+		{
+			if ( n > _buf.size() - _pos )
+			{
+				flush();
+
+				if ( n >= _buf.size() )
+				{
+					if ( _str.rdbuf()->sputn( s, n ) != static_cast< std::streamsize >( n ) ) _str.setstate( std::ios_base::badbit );
+					_written += n;
+					return;
+				}
+			}
+
+			std::memcpy( _buf.data() + _pos, s, n );
+			_pos += n;
+		}
+
+		void flush()
+		{
+			if ( _pos == 0 ) return;
+
+			if ( _str.rdbuf()->sputn( _buf.data(), _pos ) != static_cast< std::streamsize >( _pos ) ) _str.setstate( std::ios_base::badbit );
+
+			_written += _pos;
+			_pos = 0;
 		}
 
+		// counted here rather than through tellp(), which fails on pipes and sockets
 		inline std::size_t size() const
 		{
-			return _str.tellp();
+			return _written + _pos;
 		}
 
 	private:
 		string_type & _str;
+		std::vector< char > _buf;
+		std::size_t _pos;
+		std::size_t _written;
 	};
 	template< typename A > class istream_wrapper< std::basic_string< char, std::char_traits< char >, A > >
 	{
@@ -163,9 +468,9 @@ namespace jsonhpp
 	public:
 		inline char get()
 		{
-			if ( _pos + 1 == _str.size() )
+			if ( _pos >= _str.size() )
 			{
-				throw std::out_of_range( "out of range!" );
+				JSONHPP_THROW( std::out_of_range( "out of range!" ) );
 			}
 
 			return _str[_pos++];
@@ -173,7 +478,22 @@ namespace jsonhpp
 
 		inline char peek() const
 		{
-			return _str[_pos];
+			return _pos < _str.size() ? _str[_pos] : '\0';
+		}
+
+		inline const char * data() const
+		{
+			return _str.data() + _pos;
+		}
+
+		inline std::size_t remain() const
+		{
+			return _str.size() - _pos;
+		}
+
+		inline void skip( std::size_t n )
+		{
+			_pos += n;
 		}
 
 	private:
@@ -196,6 +516,11 @@ namespace jsonhpp
 			_str.push_back( c );
 		}
 
+		inline void write( const char * s, std::size_t n )
+		{
+			_str.append( s, n );
+		}
+
 		inline std::size_t size() const
 		{
 			return _str.size();
@@ -213,17 +538,96 @@ namespace jsonhpp
 	{
 		return stream.peek();
 	}
+	template< typename T, typename = void > struct __is_contiguous : std::false_type {};
+	template< typename T > struct __is_contiguous< T, std::void_t< decltype( std::declval< T & >().data() ), decltype( std::declval< T & >().remain() ), decltype( std::declval< T & >().skip( 0 ) ) > > : std::true_type {};
+	template< typename T > inline constexpr bool __is_contiguous_v = __is_contiguous< T >::value;
+
+	template< typename T > inline const char * __stream_data( T & stream )
+	{
+		return stream.data();
+	}
+	template< typename T > inline std::size_t __stream_remain( T & stream )
+	{
+		return stream.remain();
+	}
+	template< typename T > inline void __stream_skip( T & stream, std::size_t n )
+	{
+		stream.skip( n );
+	}
+
+	inline std::uint32_t __ctz( std::uint32_t val )
+	{
+#if defined( _MSC_VER ) && !defined( __clang__ )
+		unsigned long index;
+		_BitScanForward( &index, val );
+		return index;
+#else
+		return __builtin_ctz( val );
+#endif
+	}
+	inline bool __is_space( char c )
+	{
+		return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+	}
+	inline std::size_t __skip_space( const char * str, std::size_t size )
+	{
+		std::size_t i = 0;
+
+		if ( size == 0 || !__is_space( str[0] ) ) return 0;
+
+#if defined( JSONHPP_AVX2 )
+		const __m256i space32 = _mm256_set1_epi8( ' ' ), n32 = _mm256_set1_epi8( '\n' ), r32 = _mm256_set1_epi8( '\r' ), t32 = _mm256_set1_epi8( '\t' );
+		for ( ; i + 32 <= size; i += 32 )
+		{
+			__m256i v = _mm256_loadu_si256( reinterpret_cast< const __m256i * >( str + i ) );
+			__m256i ws = _mm256_or_si256( _mm256_or_si256( _mm256_cmpeq_epi8( v, space32 ), _mm256_cmpeq_epi8( v, n32 ) ), _mm256_or_si256( _mm256_cmpeq_epi8( v, r32 ), _mm256_cmpeq_epi8( v, t32 ) ) );
+			std::uint32_t mask = ~static_cast< std::uint32_t >( _mm256_movemask_epi8( ws ) );
+			if ( mask != 0 ) return i + __ctz( mask );
+		}
+#endif
+#if defined( JSONHPP_SSE2 )
+		const __m128i space16 = _mm_set1_epi8( ' ' ), n16 = _mm_set1_epi8( '\n' ), r16 = _mm_set1_epi8( '\r' ), t16 = _mm_set1_epi8( '\t' );
+		for ( ; i + 16 <= size; i += 16 )
+		{
+			__m128i v = _mm_loadu_si128( reinterpret_cast< const __m128i * >( str + i ) );
+			__m128i ws = _mm_or_si128( _mm_or_si128( _mm_cmpeq_epi8( v, space16 ), _mm_cmpeq_epi8( v, n16 ) ), _mm_or_si128( _mm_cmpeq_epi8( v, r16 ), _mm_cmpeq_epi8( v, t16 ) ) );
+			std::uint32_t mask = ~static_cast< std::uint32_t >( _mm_movemask_epi8( ws ) ) & 0xFFFF;
+			if ( mask != 0 ) return i + __ctz( mask );
+		}
+#endif
+		while ( i < size && __is_space( str[i] ) ) ++i;
+
+		return i;
+	}
+
 	template< typename T > inline void __stream_ignore( T & stream )
 	{
-		while ( std::isspace( __stream_peek( stream ) ) )
+		if constexpr ( __is_contiguous_v< T > )
+		{
+			for ( std::size_t n = __stream_remain( stream ); n != 0; n = __stream_remain( stream ) )
+			{
+				std::size_t i = __skip_space( __stream_data( stream ), n );
+
+				__stream_skip( stream, i );
+				if ( i != n ) break;
+			}
+		}
+		else
 		{
-			__stream_get( stream );
+			while ( __is_space( __stream_peek( stream ) ) )
+			{
+				__stream_get( stream );
+			}
 		}
 	}
 	template< typename T > inline void __stream_put( T & stream, char c )
 	{
 		stream.put( c );
 	}
+	template< typename T > inline void __stream_write( T & stream, const char * s, std::size_t n )
+	{
+		stream.write( s, n );
+	}
 	template< typename T > inline bool __stream_check( T & stream, char c )
 	{
 		if ( __stream_peek( stream ) != c )
@@ -236,10 +640,7 @@ namespace jsonhpp
 	}
 	template< typename T > inline void __stream_puts( T & stream, const char * s )
 	{
-		while ( *s != '\0' )
-		{
-			__stream_put( stream, *s++ );
-		}
+		__stream_write( stream, s, std::strlen( s ) );
 	}
 	template< typename T > inline bool __stream_match( T & stream, const char * s )
 	{
@@ -255,1537 +656,5897 @@ namespace jsonhpp
 	}
 	template< typename T > inline void __stream_put_tab( T & stream, std::uint32_t depth, std::uint32_t tab )
 	{
-		if ( tab != 0 )
+		static constexpr char spaces[] = "                                                                ";
+
+		for ( std::size_t n = std::size_t( depth ) * tab; n != 0; )
 		{
-			for ( size_t i = 0; i < depth; i++ )
-			{
-				for ( size_t j = 0; j < tab; j++ )
-				{
-					__stream_put( stream, ' ' );
-				}
-			}
+			std::size_t count = std::min< std::size_t >( n, sizeof( spaces ) - 1 );
+
+			__stream_write( stream, spaces, count );
+			n -= count;
 		}
 	}
 
-	template<> class element< jsonhpp::type::null >
+	inline std::size_t __scan_string( const char * str, std::size_t size, bool ascii = false )
 	{
-	public:
-		static constexpr jsonhpp::type value_t = jsonhpp::type::null;
-
-	public:
-		element() = default;
-
-		element( element && ) = default;
-
-		element( const element & ) = default;
-
-		element( std::pmr::memory_resource * ){}
+		std::size_t i = 0;
 
-		element & operator= ( element && ) = default;
+#if defined( JSONHPP_AVX2 )
+		const __m256i quote32 = _mm256_set1_epi8( '\"' ), slash32 = _mm256_set1_epi8( '\\' ), ctrl32 = _mm256_set1_epi8( 0x1F );
+		for ( ; i + 32 <= size; i += 32 )
+		{
+			__m256i v = _mm256_loadu_si256( reinterpret_cast< const __m256i * >( str + i ) );
+			__m256i special = _mm256_or_si256( _mm256_or_si256( _mm256_cmpeq_epi8( v, quote32 ), _mm256_cmpeq_epi8( v, slash32 ) ), _mm256_cmpeq_epi8( _mm256_max_epu8( v, ctrl32 ), ctrl32 ) );
+			std::uint32_t mask = static_cast< std::uint32_t >( _mm256_movemask_epi8( special ) );
+			if ( ascii ) mask |= static_cast< std::uint32_t >( _mm256_movemask_epi8( v ) );
+			if ( mask != 0 ) return i + __ctz( mask );
+		}
+#endif
+#if defined( JSONHPP_SSE2 )
+		const __m128i quote16 = _mm_set1_epi8( '\"' ), slash16 = _mm_set1_epi8( '\\' ), ctrl16 = _mm_set1_epi8( 0x1F );
+		for ( ; i + 16 <= size; i += 16 )
+		{
+			__m128i v = _mm_loadu_si128( reinterpret_cast< const __m128i * >( str + i ) );
+			__m128i special = _mm_or_si128( _mm_or_si128( _mm_cmpeq_epi8( v, quote16 ), _mm_cmpeq_epi8( v, slash16 ) ), _mm_cmpeq_epi8( _mm_max_epu8( v, ctrl16 ), ctrl16 ) );
+			std::uint32_t mask = static_cast< std::uint32_t >( _mm_movemask_epi8( special ) );
+			if ( ascii ) mask |= static_cast< std::uint32_t >( _mm_movemask_epi8( v ) );
+			if ( mask != 0 ) return i + __ctz( mask );
+		}
+#endif
+		for ( ; i < size; ++i )
+		{
+			if ( str[i] == '\"' || str[i] == '\\' || static_cast< unsigned char >( str[i] ) < 0x20 ) break;
+			if ( ascii && static_cast< unsigned char >( str[i] ) >= 0x80 ) break;
+		}
 
-		element & operator= ( const element & ) = default;
+		return i;
+	}
+	inline std::size_t __scan_structure( const char * str, std::size_t size )
+	{
+		std::size_t i = 0;
 
-	public:
-		jsonhpp::type get_type() const
+#if defined( JSONHPP_AVX2 )
+		const __m256i quote32 = _mm256_set1_epi8( '\"' ), lower32 = _mm256_set1_epi8( 0x20 ), open32 = _mm256_set1_epi8( '{' ), close32 = _mm256_set1_epi8( '}' );
+		for ( ; i + 32 <= size; i += 32 )
 		{
-			return value_t;
+			__m256i v = _mm256_loadu_si256( reinterpret_cast< const __m256i * >( str + i ) );
+			__m256i l = _mm256_or_si256( v, lower32 );
+			__m256i special = _mm256_or_si256( _mm256_cmpeq_epi8( v, quote32 ), _mm256_or_si256( _mm256_cmpeq_epi8( l, open32 ), _mm256_cmpeq_epi8( l, close32 ) ) );
+			std::uint32_t mask = static_cast< std::uint32_t >( _mm256_movemask_epi8( special ) );
+			if ( mask != 0 ) return i + __ctz( mask );
 		}
-
-	public:
-		template< typename T > void read( istream_wrapper< T > & stream )
+#endif
+#if defined( JSONHPP_SSE2 )
+		const __m128i quote16 = _mm_set1_epi8( '\"' ), lower16 = _mm_set1_epi8( 0x20 ), open16 = _mm_set1_epi8( '{' ), close16 = _mm_set1_epi8( '}' );
+		for ( ; i + 16 <= size; i += 16 )
 		{
-			if ( !__stream_match( stream, "null" ) ) throw std::invalid_argument( "is not \'null\'!" );
+			__m128i v = _mm_loadu_si128( reinterpret_cast< const __m128i * >( str + i ) );
+			__m128i l = _mm_or_si128( v, lower16 );
+			__m128i special = _mm_or_si128( _mm_cmpeq_epi8( v, quote16 ), _mm_or_si128( _mm_cmpeq_epi8( l, open16 ), _mm_cmpeq_epi8( l, close16 ) ) );
+			std::uint32_t mask = static_cast< std::uint32_t >( _mm_movemask_epi8( special ) );
+			if ( mask != 0 ) return i + __ctz( mask );
+		}
+#endif
+		for ( ; i < size; ++i )
+		{
+			char c = str[i];
+			if ( c == '\"' || c == '[' || c == ']' || c == '{' || c == '}' ) break;
 		}
 
-		template< typename T > void write( ostream_wrapper< T > & stream, std::uint32_t depth, std::uint32_t tab = 0 ) const
+		return i;
+	}
+	inline int __hex_value( char c )
+	{
+		if ( c >= '0' && c <= '9' ) return c - '0';
+		if ( c >= 'a' && c <= 'f' ) return c - 'a' + 10;
+		if ( c >= 'A' && c <= 'F' ) return c - 'A' + 10;
+		return -1;
+	}
+	inline std::size_t __encode_utf8( std::uint32_t code, char * buf )
+	{
+		if ( code < 0x80 )
 		{
-			__stream_puts( stream, "null" );
+			buf[0] = static_cast< char >( code );
+			return 1;
+		}
+		if ( code < 0x800 )
+		{
+			buf[0] = static_cast< char >( 0xC0 | ( code >> 6 ) );
+			buf[1] = static_cast< char >( 0x80 | ( code & 0x3F ) );
+			return 2;
+		}
+		if ( code < 0x10000 )
+		{
+			buf[0] = static_cast< char >( 0xE0 | ( code >> 12 ) );
+			buf[1] = static_cast< char >( 0x80 | ( ( code >> 6 ) & 0x3F ) );
+			buf[2] = static_cast< char >( 0x80 | ( code & 0x3F ) );
+			return 3;
 		}
+
+		buf[0] = static_cast< char >( 0xF0 | ( code >> 18 ) );
+		buf[1] = static_cast< char >( 0x80 | ( ( code >> 12 ) & 0x3F ) );
+		buf[2] = static_cast< char >( 0x80 | ( ( code >> 6 ) & 0x3F ) );
+		buf[3] = static_cast< char >( 0x80 | ( code & 0x3F ) );
+		return 4;
+	}
+	inline constexpr std::uint8_t __utf8_byte_1_high[16] =
+	{
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x80, 0x80, 0x80, 0x80, 0x21, 0x01, 0x15, 0x49,
 	};
-	template<> class element< jsonhpp::type::array >;
-	template<> class element< jsonhpp::type::string >
+	inline constexpr std::uint8_t __utf8_byte_1_low[16] =
 	{
-	public:
-		static constexpr jsonhpp::type value_t = jsonhpp::type::string;
+		0xE7, 0xA3, 0x83, 0x83, 0x8B, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xDB, 0xCB, 0xCB,
+	};
+	inline constexpr std::uint8_t __utf8_byte_2_high[16] =
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xE6, 0xAE, 0xBA, 0xBA, 0x01, 0x01, 0x01, 0x01,
+	};
+	inline constexpr std::uint8_t __utf8_incomplete[32] =
+	{
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xDF, 0xBF,
+	};
+	inline std::size_t __validate_utf8( const char * str, const char * end )
+	{
+		auto c = static_cast< unsigned char >( str[0] );
+		std::size_t count = ( c >= 0xC2 && c <= 0xDF ) ? 2 : ( c >= 0xE0 && c <= 0xEF ) ? 3 : ( c >= 0xF0 && c <= 0xF4 ) ? 4 : 0;
+		if ( count == 0 || static_cast< std::size_t >( end - str ) < count ) return 0;
 
-	public:
-		element( element && ) = default;
+		auto b = static_cast< unsigned char >( str[1] );
+		unsigned char lower = ( c == 0xE0 ) ? 0xA0 : ( c == 0xF0 ) ? 0x90 : 0x80;
+		unsigned char upper = ( c == 0xED ) ? 0x9F : ( c == 0xF4 ) ? 0x8F : 0xBF;
+		if ( b < lower || b > upper ) return 0;
 
-		element( const element & ) = default;
+		for ( std::size_t i = 2; i < count; i++ )
+		{
+			if ( ( static_cast< unsigned char >( str[i] ) & 0xC0 ) != 0x80 ) return 0;
+		}
 
-		element & operator= ( element && ) = default;
+		return count;
+	}
+	inline bool __is_utf8( const char * str, std::size_t size )
+	{
+		std::size_t i = 0;
 
-		element & operator= ( const element & ) = default;
+#if defined( JSONHPP_AVX2 )
+		const __m256i byte_1_high = _mm256_broadcastsi128_si256( _mm_loadu_si128( reinterpret_cast< const __m128i * >( __utf8_byte_1_high ) ) );
+		const __m256i byte_1_low = _mm256_broadcastsi128_si256( _mm_loadu_si128( reinterpret_cast< const __m128i * >( __utf8_byte_1_low ) ) );
+		const __m256i byte_2_high = _mm256_broadcastsi128_si256( _mm_loadu_si128( reinterpret_cast< const __m128i * >( __utf8_byte_2_high ) ) );
+		const __m256i incomplete = _mm256_loadu_si256( reinterpret_cast< const __m256i * >( __utf8_incomplete ) );
+		const __m256i low4 = _mm256_set1_epi8( 0x0F ), third = _mm256_set1_epi8( 0x60 ), fourth = _mm256_set1_epi8( 0x70 ), high = _mm256_set1_epi8( static_cast< char >( 0x80 ) );
 
-		element( std::pmr::memory_resource * resource )
-			:_value( resource )
+		__m256i error = _mm256_setzero_si256(), prev_input = _mm256_setzero_si256(), prev_incomplete = _mm256_setzero_si256();
+		auto check = [&]( __m256i input )
 		{
+			if ( _mm256_movemask_epi8( input ) == 0 )
+			{
+				error = _mm256_or_si256( error, prev_incomplete );
+				prev_incomplete = _mm256_setzero_si256();
+			}
+			else
+			{
+				__m256i shifted = _mm256_permute2x128_si256( prev_input, input, 0x21 );
+				__m256i prev1 = _mm256_alignr_epi8( input, shifted, 15 ), prev2 = _mm256_alignr_epi8( input, shifted, 14 ), prev3 = _mm256_alignr_epi8( input, shifted, 13 );
 
-		}
-
-		element( std::pmr::memory_resource * resource, const char * str )
-			:_value( str, resource )
-		{
+				__m256i special = _mm256_and_si256( _mm256_and_si256(
+					_mm256_shuffle_epi8( byte_1_high, _mm256_and_si256( _mm256_srli_epi16( prev1, 4 ), low4 ) ),
+					_mm256_shuffle_epi8( byte_1_low, _mm256_and_si256( prev1, low4 ) ) ),
+					_mm256_shuffle_epi8( byte_2_high, _mm256_and_si256( _mm256_srli_epi16( input, 4 ), low4 ) ) );
+				__m256i must23 = _mm256_and_si256( _mm256_or_si256( _mm256_subs_epu8( prev2, third ), _mm256_subs_epu8( prev3, fourth ) ), high );
 
-		}
+				error = _mm256_or_si256( error, _mm256_xor_si256( must23, special ) );
+				prev_incomplete = _mm256_subs_epu8( input, incomplete );
+			}
+			prev_input = input;
+		};
 
-		element( std::pmr::memory_resource * resource, std::string_view str )
-			:_value( str.data(), str.size(), resource )
+		for ( ; i + 32 <= size; i += 32 )
 		{
-
+			check( _mm256_loadu_si256( reinterpret_cast< const __m256i * >( str + i ) ) );
 		}
-
-		template< typename A > element( std::pmr::memory_resource * resource, const std::basic_string< char, std::char_traits< char >, A > & str )
-			: _value( str.data(), str.size(), resource )
+		if ( i < size )
 		{
-
+			char block[32] = {};
+			std::memcpy( block, str + i, size - i );
+			check( _mm256_loadu_si256( reinterpret_cast< const __m256i * >( block ) ) );
 		}
+		error = _mm256_or_si256( error, prev_incomplete );
 
-		element & operator= ( const char * str )
+		return _mm256_testz_si256( error, error ) != 0;
+#elif defined( JSONHPP_SSSE3 )
+		const __m128i byte_1_high = _mm_loadu_si128( reinterpret_cast< const __m128i * >( __utf8_byte_1_high ) );
+		const __m128i byte_1_low = _mm_loadu_si128( reinterpret_cast< const __m128i * >( __utf8_byte_1_low ) );
+		const __m128i byte_2_high = _mm_loadu_si128( reinterpret_cast< const __m128i * >( __utf8_byte_2_high ) );
+		const __m128i incomplete = _mm_loadu_si128( reinterpret_cast< const __m128i * >( __utf8_incomplete + 16 ) );
+		const __m128i low4 = _mm_set1_epi8( 0x0F ), third = _mm_set1_epi8( 0x60 ), fourth = _mm_set1_epi8( 0x70 ), high = _mm_set1_epi8( static_cast< char >( 0x80 ) );
+
+		__m128i error = _mm_setzero_si128(), prev_input = _mm_setzero_si128(), prev_incomplete = _mm_setzero_si128();
+		auto check = [&]( __m128i input )
 		{
-			_value = str;
-			return *this;
-		}
+			if ( _mm_movemask_epi8( input ) == 0 )
+			{
+				error = _mm_or_si128( error, prev_incomplete );
+				prev_incomplete = _mm_setzero_si128();
+			}
+			else
+			{
+				__m128i prev1 = _mm_alignr_epi8( input, prev_input, 15 ), prev2 = _mm_alignr_epi8( input, prev_input, 14 ), prev3 = _mm_alignr_epi8( input, prev_input, 13 );
 
-		element & operator= ( std::string_view str )
-		{
-			_value.assign( str.data(), str.size() );
+				__m128i special = _mm_and_si128( _mm_and_si128(
+					_mm_shuffle_epi8( byte_1_high, _mm_and_si128( _mm_srli_epi16( prev1, 4 ), low4 ) ),
+					_mm_shuffle_epi8( byte_1_low, _mm_and_si128( prev1, low4 ) ) ),
+					_mm_shuffle_epi8( byte_2_high, _mm_and_si128( _mm_srli_epi16( input, 4 ), low4 ) ) );
+				__m128i must23 = _mm_and_si128( _mm_or_si128( _mm_subs_epu8( prev2, third ), _mm_subs_epu8( prev3, fourth ) ), high );
 
-			return *this;
-		}
+				error = _mm_or_si128( error, _mm_xor_si128( must23, special ) );
+				prev_incomplete = _mm_subs_epu8( input, incomplete );
+			}
+			prev_input = input;
+		};
 
-		template< typename A > element & operator= ( const std::basic_string< char, std::char_traits< char >, A > & str )
+		for ( ; i + 16 <= size; i += 16 )
 		{
-			_value = str;
-			return *this;
+			check( _mm_loadu_si128( reinterpret_cast< const __m128i * >( str + i ) ) );
 		}
-
-	public:
-		operator const char * ( ) const
+		if ( i < size )
 		{
-			return _value.c_str();
+			char block[16] = {};
+			std::memcpy( block, str + i, size - i );
+			check( _mm_loadu_si128( reinterpret_cast< const __m128i * >( block ) ) );
 		}
+		error = _mm_or_si128( error, prev_incomplete );
 
-		operator std::string_view() const
+		return _mm_movemask_epi8( _mm_cmpeq_epi8( error, _mm_setzero_si128() ) ) == 0xFFFF;
+#else
+		while ( i < size )
 		{
-			return { _value.data(), _value.size() };
-		}
+#if defined( JSONHPP_SSE2 )
+			if ( i + 16 <= size && _mm_movemask_epi8( _mm_loadu_si128( reinterpret_cast< const __m128i * >( str + i ) ) ) == 0 )
+			{
+				i += 16;
+				continue;
+			}
+#endif
+			if ( static_cast< unsigned char >( str[i] ) < 0x80 )
+			{
+				++i;
+				continue;
+			}
 
-		operator const std::pmr::string & ( ) const
-		{
-			return _value;
-		}
+			std::size_t n = __validate_utf8( str + i, str + size );
+			if ( n == 0 ) return false;
 
-		template< typename A > operator std::basic_string< char, std::char_traits< char >, A >() const
-		{
-			return { _value.begin(), _value.end() };
+			i += n;
 		}
 
-	public:
-		jsonhpp::type get_type() const
+		return true;
+#endif
+	}
+	inline void __check_utf8( [[maybe_unused]] const char * str, [[maybe_unused]] std::size_t size )
+	{
+#if defined( JSONHPP_VALIDATE_UTF8 )
+		if ( !__is_utf8( str, size ) ) JSONHPP_THROW( std::invalid_argument( "invalid utf-8!" ) );
+#endif
+	}
+	template< typename T > std::uint32_t __read_hex4( T & stream )
+	{
+		std::uint32_t code = 0;
+		for ( int i = 0; i < 4; i++ )
 		{
-			return value_t;
+			int h = __hex_value( __stream_get( stream ) );
+			if ( h < 0 ) JSONHPP_THROW( std::invalid_argument( "invalid \\u escape!" ) );
+
+			code = ( code << 4 ) | static_cast< std::uint32_t >( h );
 		}
+		return code;
+	}
+	template< typename T, typename S > void __read_escape( T & stream, S & str )
+	{
+		char c = __stream_get( stream );
+		switch ( c )
+		{
+		case '\"': str.push_back( '\"' ); break;
+		case '\\': str.push_back( '\\' ); break;
+		case '/': str.push_back( '/' ); break;
+		case 'b': str.push_back( '\b' ); break;
+		case 'f': str.push_back( '\f' ); break;
+		case 'n': str.push_back( '\n' ); break;
+		case 'r': str.push_back( '\r' ); break;
+		case 't': str.push_back( '\t' ); break;
+		case 'u':
+		{
+			std::uint32_t code = __read_hex4( stream );
+			if ( code >= 0xD800 && code <= 0xDBFF )
+			{
+				if ( !__stream_match( stream, "\\u" ) ) JSONHPP_THROW( std::invalid_argument( "unpaired surrogate!" ) );
 
-	public:
-		template< typename T > void read( istream_wrapper< T > & stream )
+				std::uint32_t low = __read_hex4( stream );
+				if ( low < 0xDC00 || low > 0xDFFF ) JSONHPP_THROW( std::invalid_argument( "unpaired surrogate!" ) );
+
+				code = 0x10000 + ( ( code - 0xD800 ) << 10 ) + ( low - 0xDC00 );
+			}
+			else if ( code >= 0xDC00 && code <= 0xDFFF )
+			{
+				JSONHPP_THROW( std::invalid_argument( "unpaired surrogate!" ) );
+			}
+
+			char buf[4];
+			str.append( buf, __encode_utf8( code, buf ) );
+		}
+		break;
+		default:
+			JSONHPP_THROW( std::invalid_argument( "invalid escape!" ) );
+		}
+	}
+	template< typename T, typename S > void __read_string_body( T & stream, S & str )
+	{
+		while ( true )
 		{
-			if ( !__stream_check(stream, '\"' ) ) throw std::invalid_argument( R"(unable to match "!)" );
+			char c;
+
+			if constexpr ( __is_contiguous_v< T > )
+			{
+				std::size_t n = __stream_remain( stream );
+				if ( n == 0 ) JSONHPP_THROW( std::out_of_range( "out of range" ) );
+
+				const char * data = __stream_data( stream );
+				std::size_t i = __scan_string( data, n );
+
+				str.append( data, i );
+				__stream_skip( stream, i );
+				if ( i == n ) continue;
+
+				c = __stream_get( stream );
+			}
+			else
 			{
-				while ( __stream_peek( stream ) != '\"' )
+				c = __stream_get( stream );
+				if ( c != '\"' && c != '\\' && static_cast< unsigned char >( c ) >= 0x20 )
 				{
-					_value.push_back( __stream_get( stream ) );
+					str.push_back( c );
+					continue;
 				}
 			}
-			if ( !__stream_check( stream, '\"' ) ) throw std::invalid_argument( R"(unable to match "!)" );
+
+			if ( c == '\"' ) break;
+			if ( c != '\\' ) JSONHPP_THROW( std::invalid_argument( "control character in string!" ) );
+
+			__read_escape( stream, str );
 		}
+	}
+
+	template< typename T, typename S > void __read_string( T & stream, S & str )
+	{
+		if ( !__stream_check( stream, '\"' ) ) JSONHPP_THROW( std::invalid_argument( R"(unable to match "!)" ) );
 
-		template< typename T > void write( ostream_wrapper< T > & stream, std::uint32_t depth, std::uint32_t tab = 0 ) const
+		__read_string_body( stream, str );
+		__check_utf8( str.data(), str.size() );
+	}
+	inline std::string_view __read_string_insitu( istream_wrapper< char * > & stream, std::pmr::string & str )
+	{
+		struct sink
 		{
-			__stream_put( stream, '\"' );
-			for ( const auto & c : _value )
+			void push_back( char c )
 			{
-				__stream_put( stream, c );
+				*out++ = c;
 			}
-			__stream_put( stream, '\"' );
-		}
-
-	private:
-		std::pmr::string _value;
-	};
-	template<> class element< jsonhpp::type::number >
-	{
-	public:
-		static constexpr jsonhpp::type value_t = jsonhpp::type::number;
 
-	public:
-		element( element && ) = default;
+			void append( const char * s, std::size_t n )
+			{
+				std::memmove( out, s, n );
+				out += n;
+			}
 
-		element( const element & ) = default;
+			char * out;
+		};
 
-		element & operator= ( element && ) = default;
+		if ( !__stream_check( stream, '\"' ) ) JSONHPP_THROW( std::invalid_argument( R"(unable to match "!)" ) );
 
-		element & operator= ( const element & ) = default;
+		char * buf = stream.mutable_data();
+		const char * data = stream.data();
+		std::size_t n = stream.remain();
+		std::size_t i = __scan_string( data, n );
 
-		element( float val )
-			:_value( val )
-		{}
+		if ( i == n ) JSONHPP_THROW( std::out_of_range( "out of range" ) );
+		if ( data[i] != '\"' && data[i] != '\\' ) JSONHPP_THROW( std::invalid_argument( "control character in string!" ) );
 
-		element( double val )
-			:_value( val )
-		{}
+		if ( data[i] == '\"' )
+		{
+			__check_utf8( data, i );
+			stream.skip( i + 1 );
+			if ( buf != nullptr ) buf[i] = '\0';
 
-		element( std::int8_t val )
-			:_value( std::int64_t( val ) )
-		{}
+			return { data, i };
+		}
 
-		element( std::int16_t val )
-			:_value( std::int64_t( val ) )
-		{}
+		stream.skip( i );
+		if ( buf == nullptr )
+		{
+			str.assign( data, i );
+			__read_string_body( stream, str );
+			__check_utf8( str.data(), str.size() );
 
-		element( std::int32_t val )
-			:_value( std::int64_t( val ) )
-		{}
+			return {};
+		}
 
-		element( std::int64_t val )
-			:_value( val )
-		{}
+		sink out{ buf + i };
+		while ( true )
+		{
+			data = stream.data();
+			n = stream.remain();
+			i = __scan_string( data, n );
+			if ( i == n ) JSONHPP_THROW( std::out_of_range( "out of range" ) );
 
-		element( std::uint8_t val )
-			:_value( std::uint64_t( val ) )
-		{}
+			out.append( data, i );
+			stream.skip( i );
 
-		element( std::uint16_t val )
-			:_value( std::uint64_t( val ) )
-		{}
+			char c = stream.get();
+			if ( c == '\"' ) break;
+			if ( c != '\\' ) JSONHPP_THROW( std::invalid_argument( "control character in string!" ) );
 
-		element( std::uint32_t val )
-			:_value( std::uint64_t( val ) )
-		{}
+			__read_escape( stream, out );
+		}
+		*out.out = '\0';
+		__check_utf8( buf, out.out - buf );
 
-		element( std::uint64_t val )
-			:_value( val )
-		{}
+		return { buf, static_cast< std::size_t >( out.out - buf ) };
+	}
+	inline bool __decode_utf8( const char *& str, const char * end, std::uint32_t & code )
+	{
+		auto c = static_cast< unsigned char >( *str++ );
+		if ( c < 0x80 )
+		{
+			code = c;
+			return true;
+		}
 
-		element( std::pmr::memory_resource * ) {}
+		std::size_t count = ( c >= 0xF0 ) ? 3 : ( c >= 0xE0 ) ? 2 : ( c >= 0xC0 ) ? 1 : 0;
+		if ( count == 0 || c > 0xF4 || static_cast< std::size_t >( end - str ) < count ) return false;
 
-		element & operator= ( double val )
+		code = c & ( 0x3F >> count );
+		for ( std::size_t i = 0; i < count; i++ )
 		{
-			_value = val;
-			return *this;
+			auto b = static_cast< unsigned char >( *str++ );
+			if ( ( b & 0xC0 ) != 0x80 ) return false;
+
+			code = ( code << 6 ) | ( b & 0x3F );
 		}
 
-		element & operator= ( std::int64_t val )
+		static constexpr std::uint32_t min[] = { 0, 0x80, 0x800, 0x10000 };
+
+		return code >= min[count] && code <= 0x10FFFF && ( code < 0xD800 || code > 0xDFFF );
+	}
+	template< typename T > void __write_invalid_utf8( T & /*stream*/ )
+	{
+		JSONHPP_THROW( std::invalid_argument( "invalid utf-8!" ) );
+	}
+	// a fixed buffer records the failure instead, so that try_write can report it without throwing
+	inline void __write_invalid_utf8( ostream_wrapper< char * > & stream )
+	{
+		stream.fail( jsonhpp::error::invalid_utf8 );
+	}
+	template< typename T > void __write_escape( T & stream, std::uint32_t code )
+	{
+		static constexpr char hex[] = "0123456789abcdef";
+
+		char buf[6] = { '\\', 'u' };
+		for ( int i = 0; i < 4; i++ )
 		{
-			_value = val;
-			return *this;
+			buf[2 + i] = hex[( code >> ( 12 - i * 4 ) ) & 0xF];
 		}
+		__stream_write( stream, buf, 6 );
+	}
+	template< typename T > void __write_string( T & stream, const char * str, std::size_t size, bool ascii )
+	{
+		const char * end = str + size;
 
-		element & operator= ( std::uint64_t val )
+		__stream_put( stream, '\"' );
+		while ( str != end )
 		{
-			_value = val;
-			return *this;
+			std::size_t i = __scan_string( str, end - str, ascii );
+
+			__stream_write( stream, str, i );
+			str += i;
+			if ( str == end ) break;
+
+			switch ( *str )
+			{
+			case '\"': __stream_write( stream, "\\\"", 2 ); ++str; break;
+			case '\\': __stream_write( stream, "\\\\", 2 ); ++str; break;
+			case '\b': __stream_write( stream, "\\b", 2 ); ++str; break;
+			case '\f': __stream_write( stream, "\\f", 2 ); ++str; break;
+			case '\n': __stream_write( stream, "\\n", 2 ); ++str; break;
+			case '\r': __stream_write( stream, "\\r", 2 ); ++str; break;
+			case '\t': __stream_write( stream, "\\t", 2 ); ++str; break;
+			default:
+			{
+				std::uint32_t code;
+				if ( !__decode_utf8( str, end, code ) )
+				{
+					__write_invalid_utf8( stream );
+					return;
+				}
+
+				if ( code >= 0x10000 )
+				{
+					code -= 0x10000;
+					__write_escape( stream, 0xD800 + ( code >> 10 ) );
+					__write_escape( stream, 0xDC00 + ( code & 0x3FF ) );
+				}
+				else
+				{
+					__write_escape( stream, code );
+				}
+			}
+			break;
+			}
 		}
+		__stream_put( stream, '\"' );
+	}
 
-	public:
-		operator float() const
+	inline constexpr std::uint64_t __power_of_five_128[] =
+	{
+		0xeef453d6923bd65a, 0x113faa2906a13b3f,
+		0x9558b4661b6565f8, 0x4ac7ca59a424c507,
+		0xbaaee17fa23ebf76, 0x5d79bcf00d2df649,
+		0xe95a99df8ace6f53, 0xf4d82c2c107973dc,
+		0x91d8a02bb6c10594, 0x79071b9b8a4be869,
+		0xb64ec836a47146f9, 0x9748e2826cdee284,
+		0xe3e27a444d8d98b7, 0xfd1b1b2308169b25,
+		0x8e6d8c6ab0787f72, 0xfe30f0f5e50e20f7,
+		0xb208ef855c969f4f, 0xbdbd2d335e51a935,
+		0xde8b2b66b3bc4723, 0xad2c788035e61382,
+		0x8b16fb203055ac76, 0x4c3bcb5021afcc31,
+		0xaddcb9e83c6b1793, 0xdf4abe242a1bbf3d,
+		0xd953e8624b85dd78, 0xd71d6dad34a2af0d,
+		0x87d4713d6f33aa6b, 0x8672648c40e5ad68,
+		0xa9c98d8ccb009506, 0x680efdaf511f18c2,
+		0xd43bf0effdc0ba48, 0x0212bd1b2566def2,
+		0x84a57695fe98746d, 0x014bb630f7604b57,
+		0xa5ced43b7e3e9188, 0x419ea3bd35385e2d,
+		0xcf42894a5dce35ea, 0x52064cac828675b9,
+		0x818995ce7aa0e1b2, 0x7343efebd1940993,
+		0xa1ebfb4219491a1f, 0x1014ebe6c5f90bf8,
+		0xca66fa129f9b60a6, 0xd41a26e077774ef6,
+		0xfd00b897478238d0, 0x8920b098955522b4,
+		0x9e20735e8cb16382, 0x55b46e5f5d5535b0,
+		0xc5a890362fddbc62, 0xeb2189f734aa831d,
+		0xf712b443bbd52b7b, 0xa5e9ec7501d523e4,
+		0x9a6bb0aa55653b2d, 0x47b233c92125366e,
+		0xc1069cd4eabe89f8, 0x999ec0bb696e840a,
+		0xf148440a256e2c76, 0xc00670ea43ca250d,
+		0x96cd2a865764dbca, 0x380406926a5e5728,
+		0xbc807527ed3e12bc, 0xc605083704f5ecf2,
+		0xeba09271e88d976b, 0xf7864a44c633682e,
+		0x93445b8731587ea3, 0x7ab3ee6afbe0211d,
+		0xb8157268fdae9e4c, 0x5960ea05bad82964,
+		0xe61acf033d1a45df, 0x6fb92487298e33bd,
+		0x8fd0c16206306bab, 0xa5d3b6d479f8e056,
+		0xb3c4f1ba87bc8696, 0x8f48a4899877186c,
+		0xe0b62e2929aba83c, 0x331acdabfe94de87,
+		0x8c71dcd9ba0b4925, 0x9ff0c08b7f1d0b14,
+		0xaf8e5410288e1b6f, 0x07ecf0ae5ee44dd9,
+		0xdb71e91432b1a24a, 0xc9e82cd9f69d6150,
+		0x892731ac9faf056e, 0xbe311c083a225cd2,
+		0xab70fe17c79ac6ca, 0x6dbd630a48aaf406,
+		0xd64d3d9db981787d, 0x092cbbccdad5b108,
+		0x85f0468293f0eb4e, 0x25bbf56008c58ea5,
+		0xa76c582338ed2621, 0xaf2af2b80af6f24e,
+		0xd1476e2c07286faa, 0x1af5af660db4aee1,
+		0x82cca4db847945ca, 0x50d98d9fc890ed4d,
+		0xa37fce126597973c, 0xe50ff107bab528a0,
+		0xcc5fc196fefd7d0c, 0x1e53ed49a96272c8,
+		0xff77b1fcbebcdc4f, 0x25e8e89c13bb0f7a,
+		0x9faacf3df73609b1, 0x77b191618c54e9ac,
+		0xc795830d75038c1d, 0xd59df5b9ef6a2417,
+		0xf97ae3d0d2446f25, 0x4b0573286b44ad1d,
+		0x9becce62836ac577, 0x4ee367f9430aec32,
+		0xc2e801fb244576d5, 0x229c41f793cda73f,
+		0xf3a20279ed56d48a, 0x6b43527578c1110f,
+		0x9845418c345644d6, 0x830a13896b78aaa9,
+		0xbe5691ef416bd60c, 0x23cc986bc656d553,
+		0xedec366b11c6cb8f, 0x2cbfbe86b7ec8aa8,
+		0x94b3a202eb1c3f39, 0x7bf7d71432f3d6a9,
+		0xb9e08a83a5e34f07, 0xdaf5ccd93fb0cc53,
+		0xe858ad248f5c22c9, 0xd1b3400f8f9cff68,
+		0x91376c36d99995be, 0x23100809b9c21fa1,
+		0xb58547448ffffb2d, 0xabd40a0c2832a78a,
+		0xe2e69915b3fff9f9, 0x16c90c8f323f516c,
+		0x8dd01fad907ffc3b, 0xae3da7d97f6792e3,
+		0xb1442798f49ffb4a, 0x99cd11cfdf41779c,
+		0xdd95317f31c7fa1d, 0x40405643d711d583,
+		0x8a7d3eef7f1cfc52, 0x482835ea666b2572,
+		0xad1c8eab5ee43b66, 0xda3243650005eecf,
+		0xd863b256369d4a40, 0x90bed43e40076a82,
+		0x873e4f75e2224e68, 0x5a7744a6e804a291,
+		0xa90de3535aaae202, 0x711515d0a205cb36,
+		0xd3515c2831559a83, 0x0d5a5b44ca873e03,
+		0x8412d9991ed58091, 0xe858790afe9486c2,
+		0xa5178fff668ae0b6, 0x626e974dbe39a872,
+		0xce5d73ff402d98e3, 0xfb0a3d212dc8128f,
+		0x80fa687f881c7f8e, 0x7ce66634bc9d0b99,
+		0xa139029f6a239f72, 0x1c1fffc1ebc44e80,
+		0xc987434744ac874e, 0xa327ffb266b56220,
+		0xfbe9141915d7a922, 0x4bf1ff9f0062baa8,
+		0x9d71ac8fada6c9b5, 0x6f773fc3603db4a9,
+		0xc4ce17b399107c22, 0xcb550fb4384d21d3,
+		0xf6019da07f549b2b, 0x7e2a53a146606a48,
+		0x99c102844f94e0fb, 0x2eda7444cbfc426d,
+		0xc0314325637a1939, 0xfa911155fefb5308,
+		0xf03d93eebc589f88, 0x793555ab7eba27ca,
+		0x96267c7535b763b5, 0x4bc1558b2f3458de,
+		0xbbb01b9283253ca2, 0x9eb1aaedfb016f16,
+		0xea9c227723ee8bcb, 0x465e15a979c1cadc,
+		0x92a1958a7675175f, 0x0bfacd89ec191ec9,
+		0xb749faed14125d36, 0xcef980ec671f667b,
+		0xe51c79a85916f484, 0x82b7e12780e7401a,
+		0x8f31cc0937ae58d2, 0xd1b2ecb8b0908810,
+		0xb2fe3f0b8599ef07, 0x861fa7e6dcb4aa15,
+		0xdfbdcece67006ac9, 0x67a791e093e1d49a,
+		0x8bd6a141006042bd, 0xe0c8bb2c5c6d24e0,
+		0xaecc49914078536d, 0x58fae9f773886e18,
+		0xda7f5bf590966848, 0xaf39a475506a899e,
+		0x888f99797a5e012d, 0x6d8406c952429603,
+		0xaab37fd7d8f58178, 0xc8e5087ba6d33b83,
+		0xd5605fcdcf32e1d6, 0xfb1e4a9a90880a64,
+		0x855c3be0a17fcd26, 0x5cf2eea09a55067f,
+		0xa6b34ad8c9dfc06f, 0xf42faa48c0ea481e,
+		0xd0601d8efc57b08b, 0xf13b94daf124da26,
+		0x823c12795db6ce57, 0x76c53d08d6b70858,
+		0xa2cb1717b52481ed, 0x54768c4b0c64ca6e,
+		0xcb7ddcdda26da268, 0xa9942f5dcf7dfd09,
+		0xfe5d54150b090b02, 0xd3f93b35435d7c4c,
+		0x9efa548d26e5a6e1, 0xc47bc5014a1a6daf,
+		0xc6b8e9b0709f109a, 0x359ab6419ca1091b,
+		0xf867241c8cc6d4c0, 0xc30163d203c94b62,
+		0x9b407691d7fc44f8, 0x79e0de63425dcf1d,
+		0xc21094364dfb5636, 0x985915fc12f542e4,
+		0xf294b943e17a2bc4, 0x3e6f5b7b17b2939d,
+		0x979cf3ca6cec5b5a, 0xa705992ceecf9c42,
+		0xbd8430bd08277231, 0x50c6ff782a838353,
+		0xece53cec4a314ebd, 0xa4f8bf5635246428,
+		0x940f4613ae5ed136, 0x871b7795e136be99,
+		0xb913179899f68584, 0x28e2557b59846e3f,
+		0xe757dd7ec07426e5, 0x331aeada2fe589cf,
+		0x9096ea6f3848984f, 0x3ff0d2c85def7621,
+		0xb4bca50b065abe63, 0x0fed077a756b53a9,
+		0xe1ebce4dc7f16dfb, 0xd3e8495912c62894,
+		0x8d3360f09cf6e4bd, 0x64712dd7abbbd95c,
+		0xb080392cc4349dec, 0xbd8d794d96aacfb3,
+		0xdca04777f541c567, 0xecf0d7a0fc5583a0,
+		0x89e42caaf9491b60, 0xf41686c49db57244,
+		0xac5d37d5b79b6239, 0x311c2875c522ced5,
+		0xd77485cb25823ac7, 0x7d633293366b828b,
+		0x86a8d39ef77164bc, 0xae5dff9c02033197,
+		0xa8530886b54dbdeb, 0xd9f57f830283fdfc,
+		0xd267caa862a12d66, 0xd072df63c324fd7b,
+		0x8380dea93da4bc60, 0x4247cb9e59f71e6d,
+		0xa46116538d0deb78, 0x52d9be85f074e608,
+		0xcd795be870516656, 0x67902e276c921f8b,
+		0x806bd9714632dff6, 0x00ba1cd8a3db53b6,
+		0xa086cfcd97bf97f3, 0x80e8a40eccd228a4,
+		0xc8a883c0fdaf7df0, 0x6122cd128006b2cd,
+		0xfad2a4b13d1b5d6c, 0x796b805720085f81,
+		0x9cc3a6eec6311a63, 0xcbe3303674053bb0,
+		0xc3f490aa77bd60fc, 0xbedbfc4411068a9c,
+		0xf4f1b4d515acb93b, 0xee92fb5515482d44,
+		0x991711052d8bf3c5, 0x751bdd152d4d1c4a,
+		0xbf5cd54678eef0b6, 0xd262d45a78a0635d,
+		0xef340a98172aace4, 0x86fb897116c87c34,
+		0x9580869f0e7aac0e, 0xd45d35e6ae3d4da0,
+		0xbae0a846d2195712, 0x8974836059cca109,
+		0xe998d258869facd7, 0x2bd1a438703fc94b,
+		0x91ff83775423cc06, 0x7b6306a34627ddcf,
+		0xb67f6455292cbf08, 0x1a3bc84c17b1d542,
+		0xe41f3d6a7377eeca, 0x20caba5f1d9e4a93,
+		0x8e938662882af53e, 0x547eb47b7282ee9c,
+		0xb23867fb2a35b28d, 0xe99e619a4f23aa43,
+		0xdec681f9f4c31f31, 0x6405fa00e2ec94d4,
+		0x8b3c113c38f9f37e, 0xde83bc408dd3dd04,
+		0xae0b158b4738705e, 0x9624ab50b148d445,
+		0xd98ddaee19068c76, 0x3badd624dd9b0957,
+		0x87f8a8d4cfa417c9, 0xe54ca5d70a80e5d6,
+		0xa9f6d30a038d1dbc, 0x5e9fcf4ccd211f4c,
+		0xd47487cc8470652b, 0x7647c3200069671f,
+		0x84c8d4dfd2c63f3b, 0x29ecd9f40041e073,
+		0xa5fb0a17c777cf09, 0xf468107100525890,
+		0xcf79cc9db955c2cc, 0x7182148d4066eeb4,
+		0x81ac1fe293d599bf, 0xc6f14cd848405530,
+		0xa21727db38cb002f, 0xb8ada00e5a506a7c,
+		0xca9cf1d206fdc03b, 0xa6d90811f0e4851c,
+		0xfd442e4688bd304a, 0x908f4a166d1da663,
+		0x9e4a9cec15763e2e, 0x9a598e4e043287fe,
+		0xc5dd44271ad3cdba, 0x40eff1e1853f29fd,
+		0xf7549530e188c128, 0xd12bee59e68ef47c,
+		0x9a94dd3e8cf578b9, 0x82bb74f8301958ce,
+		0xc13a148e3032d6e7, 0xe36a52363c1faf01,
+		0xf18899b1bc3f8ca1, 0xdc44e6c3cb279ac1,
+		0x96f5600f15a7b7e5, 0x29ab103a5ef8c0b9,
+		0xbcb2b812db11a5de, 0x7415d448f6b6f0e7,
+		0xebdf661791d60f56, 0x111b495b3464ad21,
+		0x936b9fcebb25c995, 0xcab10dd900beec34,
+		0xb84687c269ef3bfb, 0x3d5d514f40eea742,
+		0xe65829b3046b0afa, 0x0cb4a5a3112a5112,
+		0x8ff71a0fe2c2e6dc, 0x47f0e785eaba72ab,
+		0xb3f4e093db73a093, 0x59ed216765690f56,
+		0xe0f218b8d25088b8, 0x306869c13ec3532c,
+		0x8c974f7383725573, 0x1e414218c73a13fb,
+		0xafbd2350644eeacf, 0xe5d1929ef90898fa,
+		0xdbac6c247d62a583, 0xdf45f746b74abf39,
+		0x894bc396ce5da772, 0x6b8bba8c328eb783,
+		0xab9eb47c81f5114f, 0x066ea92f3f326564,
+		0xd686619ba27255a2, 0xc80a537b0efefebd,
+		0x8613fd0145877585, 0xbd06742ce95f5f36,
+		0xa798fc4196e952e7, 0x2c48113823b73704,
+		0xd17f3b51fca3a7a0, 0xf75a15862ca504c5,
+		0x82ef85133de648c4, 0x9a984d73dbe722fb,
+		0xa3ab66580d5fdaf5, 0xc13e60d0d2e0ebba,
+		0xcc963fee10b7d1b3, 0x318df905079926a8,
+		0xffbbcfe994e5c61f, 0xfdf17746497f7052,
+		0x9fd561f1fd0f9bd3, 0xfeb6ea8bedefa633,
+		0xc7caba6e7c5382c8, 0xfe64a52ee96b8fc0,
+		0xf9bd690a1b68637b, 0x3dfdce7aa3c673b0,
+		0x9c1661a651213e2d, 0x06bea10ca65c084e,
+		0xc31bfa0fe5698db8, 0x486e494fcff30a62,
+		0xf3e2f893dec3f126, 0x5a89dba3c3efccfa,
+		0x986ddb5c6b3a76b7, 0xf89629465a75e01c,
+		0xbe89523386091465, 0xf6bbb397f1135823,
+		0xee2ba6c0678b597f, 0x746aa07ded582e2c,
+		0x94db483840b717ef, 0xa8c2a44eb4571cdc,
+		0xba121a4650e4ddeb, 0x92f34d62616ce413,
+		0xe896a0d7e51e1566, 0x77b020baf9c81d17,
+		0x915e2486ef32cd60, 0x0ace1474dc1d122e,
+		0xb5b5ada8aaff80b8, 0x0d819992132456ba,
+		0xe3231912d5bf60e6, 0x10e1fff697ed6c69,
+		0x8df5efabc5979c8f, 0xca8d3ffa1ef463c1,
+		0xb1736b96b6fd83b3, 0xbd308ff8a6b17cb2,
+		0xddd0467c64bce4a0, 0xac7cb3f6d05ddbde,
+		0x8aa22c0dbef60ee4, 0x6bcdf07a423aa96b,
+		0xad4ab7112eb3929d, 0x86c16c98d2c953c6,
+		0xd89d64d57a607744, 0xe871c7bf077ba8b7,
+		0x87625f056c7c4a8b, 0x11471cd764ad4972,
+		0xa93af6c6c79b5d2d, 0xd598e40d3dd89bcf,
+		0xd389b47879823479, 0x4aff1d108d4ec2c3,
+		0x843610cb4bf160cb, 0xcedf722a585139ba,
+		0xa54394fe1eedb8fe, 0xc2974eb4ee658828,
+		0xce947a3da6a9273e, 0x733d226229feea32,
+		0x811ccc668829b887, 0x0806357d5a3f525f,
+		0xa163ff802a3426a8, 0xca07c2dcb0cf26f7,
+		0xc9bcff6034c13052, 0xfc89b393dd02f0b5,
+		0xfc2c3f3841f17c67, 0xbbac2078d443ace2,
+		0x9d9ba7832936edc0, 0xd54b944b84aa4c0d,
+		0xc5029163f384a931, 0x0a9e795e65d4df11,
+		0xf64335bcf065d37d, 0x4d4617b5ff4a16d5,
+		0x99ea0196163fa42e, 0x504bced1bf8e4e45,
+		0xc06481fb9bcf8d39, 0xe45ec2862f71e1d6,
+		0xf07da27a82c37088, 0x5d767327bb4e5a4c,
+		0x964e858c91ba2655, 0x3a6a07f8d510f86f,
+		0xbbe226efb628afea, 0x890489f70a55368b,
+		0xeadab0aba3b2dbe5, 0x2b45ac74ccea842e,
+		0x92c8ae6b464fc96f, 0x3b0b8bc90012929d,
+		0xb77ada0617e3bbcb, 0x09ce6ebb40173744,
+		0xe55990879ddcaabd, 0xcc420a6a101d0515,
+		0x8f57fa54c2a9eab6, 0x9fa946824a12232d,
+		0xb32df8e9f3546564, 0x47939822dc96abf9,
+		0xdff9772470297ebd, 0x59787e2b93bc56f7,
+		0x8bfbea76c619ef36, 0x57eb4edb3c55b65a,
+		0xaefae51477a06b03, 0xede622920b6b23f1,
+		0xdab99e59958885c4, 0xe95fab368e45eced,
+		0x88b402f7fd75539b, 0x11dbcb0218ebb414,
+		0xaae103b5fcd2a881, 0xd652bdc29f26a119,
+		0xd59944a37c0752a2, 0x4be76d3346f0495f,
+		0x857fcae62d8493a5, 0x6f70a4400c562ddb,
+		0xa6dfbd9fb8e5b88e, 0xcb4ccd500f6bb952,
+		0xd097ad07a71f26b2, 0x7e2000a41346a7a7,
+		0x825ecc24c873782f, 0x8ed400668c0c28c8,
+		0xa2f67f2dfa90563b, 0x728900802f0f32fa,
+		0xcbb41ef979346bca, 0x4f2b40a03ad2ffb9,
+		0xfea126b7d78186bc, 0xe2f610c84987bfa8,
+		0x9f24b832e6b0f436, 0x0dd9ca7d2df4d7c9,
+		0xc6ede63fa05d3143, 0x91503d1c79720dbb,
+		0xf8a95fcf88747d94, 0x75a44c6397ce912a,
+		0x9b69dbe1b548ce7c, 0xc986afbe3ee11aba,
+		0xc24452da229b021b, 0xfbe85badce996168,
+		0xf2d56790ab41c2a2, 0xfae27299423fb9c3,
+		0x97c560ba6b0919a5, 0xdccd879fc967d41a,
+		0xbdb6b8e905cb600f, 0x5400e987bbc1c920,
+		0xed246723473e3813, 0x290123e9aab23b68,
+		0x9436c0760c86e30b, 0xf9a0b6720aaf6521,
+		0xb94470938fa89bce, 0xf808e40e8d5b3e69,
+		0xe7958cb87392c2c2, 0xb60b1d1230b20e04,
+		0x90bd77f3483bb9b9, 0xb1c6f22b5e6f48c2,
+		0xb4ecd5f01a4aa828, 0x1e38aeb6360b1af3,
+		0xe2280b6c20dd5232, 0x25c6da63c38de1b0,
+		0x8d590723948a535f, 0x579c487e5a38ad0e,
+		0xb0af48ec79ace837, 0x2d835a9df0c6d851,
+		0xdcdb1b2798182244, 0xf8e431456cf88e65,
+		0x8a08f0f8bf0f156b, 0x1b8e9ecb641b58ff,
+		0xac8b2d36eed2dac5, 0xe272467e3d222f3f,
+		0xd7adf884aa879177, 0x5b0ed81dcc6abb0f,
+		0x86ccbb52ea94baea, 0x98e947129fc2b4e9,
+		0xa87fea27a539e9a5, 0x3f2398d747b36224,
+		0xd29fe4b18e88640e, 0x8eec7f0d19a03aad,
+		0x83a3eeeef9153e89, 0x1953cf68300424ac,
+		0xa48ceaaab75a8e2b, 0x5fa8c3423c052dd7,
+		0xcdb02555653131b6, 0x3792f412cb06794d,
+		0x808e17555f3ebf11, 0xe2bbd88bbee40bd0,
+		0xa0b19d2ab70e6ed6, 0x5b6aceaeae9d0ec4,
+		0xc8de047564d20a8b, 0xf245825a5a445275,
+		0xfb158592be068d2e, 0xeed6e2f0f0d56712,
+		0x9ced737bb6c4183d, 0x55464dd69685606b,
+		0xc428d05aa4751e4c, 0xaa97e14c3c26b886,
+		0xf53304714d9265df, 0xd53dd99f4b3066a8,
+		0x993fe2c6d07b7fab, 0xe546a8038efe4029,
+		0xbf8fdb78849a5f96, 0xde98520472bdd033,
+		0xef73d256a5c0f77c, 0x963e66858f6d4440,
+		0x95a8637627989aad, 0xdde7001379a44aa8,
+		0xbb127c53b17ec159, 0x5560c018580d5d52,
+		0xe9d71b689dde71af, 0xaab8f01e6e10b4a6,
+		0x9226712162ab070d, 0xcab3961304ca70e8,
+		0xb6b00d69bb55c8d1, 0x3d607b97c5fd0d22,
+		0xe45c10c42a2b3b05, 0x8cb89a7db77c506a,
+		0x8eb98a7a9a5b04e3, 0x77f3608e92adb242,
+		0xb267ed1940f1c61c, 0x55f038b237591ed3,
+		0xdf01e85f912e37a3, 0x6b6c46dec52f6688,
+		0x8b61313bbabce2c6, 0x2323ac4b3b3da015,
+		0xae397d8aa96c1b77, 0xabec975e0a0d081a,
+		0xd9c7dced53c72255, 0x96e7bd358c904a21,
+		0x881cea14545c7575, 0x7e50d64177da2e54,
+		0xaa242499697392d2, 0xdde50bd1d5d0b9e9,
+		0xd4ad2dbfc3d07787, 0x955e4ec64b44e864,
+		0x84ec3c97da624ab4, 0xbd5af13bef0b113e,
+		0xa6274bbdd0fadd61, 0xecb1ad8aeacdd58e,
+		0xcfb11ead453994ba, 0x67de18eda5814af2,
+		0x81ceb32c4b43fcf4, 0x80eacf948770ced7,
+		0xa2425ff75e14fc31, 0xa1258379a94d028d,
+		0xcad2f7f5359a3b3e, 0x096ee45813a04330,
+		0xfd87b5f28300ca0d, 0x8bca9d6e188853fc,
+		0x9e74d1b791e07e48, 0x775ea264cf55347e,
+		0xc612062576589dda, 0x95364afe032a819e,
+		0xf79687aed3eec551, 0x3a83ddbd83f52205,
+		0x9abe14cd44753b52, 0xc4926a9672793543,
+		0xc16d9a0095928a27, 0x75b7053c0f178294,
+		0xf1c90080baf72cb1, 0x5324c68b12dd6339,
+		0x971da05074da7bee, 0xd3f6fc16ebca5e04,
+		0xbce5086492111aea, 0x88f4bb1ca6bcf585,
+		0xec1e4a7db69561a5, 0x2b31e9e3d06c32e6,
+		0x9392ee8e921d5d07, 0x3aff322e62439fd0,
+		0xb877aa3236a4b449, 0x09befeb9fad487c3,
+		0xe69594bec44de15b, 0x4c2ebe687989a9b4,
+		0x901d7cf73ab0acd9, 0x0f9d37014bf60a11,
+		0xb424dc35095cd80f, 0x538484c19ef38c95,
+		0xe12e13424bb40e13, 0x2865a5f206b06fba,
+		0x8cbccc096f5088cb, 0xf93f87b7442e45d4,
+		0xafebff0bcb24aafe, 0xf78f69a51539d749,
+		0xdbe6fecebdedd5be, 0xb573440e5a884d1c,
+		0x89705f4136b4a597, 0x31680a88f8953031,
+		0xabcc77118461cefc, 0xfdc20d2b36ba7c3e,
+		0xd6bf94d5e57a42bc, 0x3d32907604691b4d,
+		0x8637bd05af6c69b5, 0xa63f9a49c2c1b110,
+		0xa7c5ac471b478423, 0x0fcf80dc33721d54,
+		0xd1b71758e219652b, 0xd3c36113404ea4a9,
+		0x83126e978d4fdf3b, 0x645a1cac083126ea,
+		0xa3d70a3d70a3d70a, 0x3d70a3d70a3d70a4,
+		0xcccccccccccccccc, 0xcccccccccccccccd,
+		0x8000000000000000, 0x0000000000000000,
+		0xa000000000000000, 0x0000000000000000,
+		0xc800000000000000, 0x0000000000000000,
+		0xfa00000000000000, 0x0000000000000000,
+		0x9c40000000000000, 0x0000000000000000,
+		0xc350000000000000, 0x0000000000000000,
+		0xf424000000000000, 0x0000000000000000,
+		0x9896800000000000, 0x0000000000000000,
+		0xbebc200000000000, 0x0000000000000000,
+		0xee6b280000000000, 0x0000000000000000,
+		0x9502f90000000000, 0x0000000000000000,
+		0xba43b74000000000, 0x0000000000000000,
+		0xe8d4a51000000000, 0x0000000000000000,
+		0x9184e72a00000000, 0x0000000000000000,
+		0xb5e620f480000000, 0x0000000000000000,
+		0xe35fa931a0000000, 0x0000000000000000,
+		0x8e1bc9bf04000000, 0x0000000000000000,
+		0xb1a2bc2ec5000000, 0x0000000000000000,
+		0xde0b6b3a76400000, 0x0000000000000000,
+		0x8ac7230489e80000, 0x0000000000000000,
+		0xad78ebc5ac620000, 0x0000000000000000,
+		0xd8d726b7177a8000, 0x0000000000000000,
+		0x878678326eac9000, 0x0000000000000000,
+		0xa968163f0a57b400, 0x0000000000000000,
+		0xd3c21bcecceda100, 0x0000000000000000,
+		0x84595161401484a0, 0x0000000000000000,
+		0xa56fa5b99019a5c8, 0x0000000000000000,
+		0xcecb8f27f4200f3a, 0x0000000000000000,
+		0x813f3978f8940984, 0x4000000000000000,
+		0xa18f07d736b90be5, 0x5000000000000000,
+		0xc9f2c9cd04674ede, 0xa400000000000000,
+		0xfc6f7c4045812296, 0x4d00000000000000,
+		0x9dc5ada82b70b59d, 0xf020000000000000,
+		0xc5371912364ce305, 0x6c28000000000000,
+		0xf684df56c3e01bc6, 0xc732000000000000,
+		0x9a130b963a6c115c, 0x3c7f400000000000,
+		0xc097ce7bc90715b3, 0x4b9f100000000000,
+		0xf0bdc21abb48db20, 0x1e86d40000000000,
+		0x96769950b50d88f4, 0x1314448000000000,
+		0xbc143fa4e250eb31, 0x17d955a000000000,
+		0xeb194f8e1ae525fd, 0x5dcfab0800000000,
+		0x92efd1b8d0cf37be, 0x5aa1cae500000000,
+		0xb7abc627050305ad, 0xf14a3d9e40000000,
+		0xe596b7b0c643c719, 0x6d9ccd05d0000000,
+		0x8f7e32ce7bea5c6f, 0xe4820023a2000000,
+		0xb35dbf821ae4f38b, 0xdda2802c8a800000,
+		0xe0352f62a19e306e, 0xd50b2037ad200000,
+		0x8c213d9da502de45, 0x4526f422cc340000,
+		0xaf298d050e4395d6, 0x9670b12b7f410000,
+		0xdaf3f04651d47b4c, 0x3c0cdd765f114000,
+		0x88d8762bf324cd0f, 0xa5880a69fb6ac800,
+		0xab0e93b6efee0053, 0x8eea0d047a457a00,
+		0xd5d238a4abe98068, 0x72a4904598d6d880,
+		0x85a36366eb71f041, 0x47a6da2b7f864750,
+		0xa70c3c40a64e6c51, 0x999090b65f67d924,
+		0xd0cf4b50cfe20765, 0xfff4b4e3f741cf6d,
+		0x82818f1281ed449f, 0xbff8f10e7a8921a4,
+		0xa321f2d7226895c7, 0xaff72d52192b6a0d,
+		0xcbea6f8ceb02bb39, 0x9bf4f8a69f764490,
+		0xfee50b7025c36a08, 0x02f236d04753d5b4,
+		0x9f4f2726179a2245, 0x01d762422c946590,
+		0xc722f0ef9d80aad6, 0x424d3ad2b7b97ef5,
+		0xf8ebad2b84e0d58b, 0xd2e0898765a7deb2,
+		0x9b934c3b330c8577, 0x63cc55f49f88eb2f,
+		0xc2781f49ffcfa6d5, 0x3cbf6b71c76b25fb,
+		0xf316271c7fc3908a, 0x8bef464e3945ef7a,
+		0x97edd871cfda3a56, 0x97758bf0e3cbb5ac,
+		0xbde94e8e43d0c8ec, 0x3d52eeed1cbea317,
+		0xed63a231d4c4fb27, 0x4ca7aaa863ee4bdd,
+		0x945e455f24fb1cf8, 0x8fe8caa93e74ef6a,
+		0xb975d6b6ee39e436, 0xb3e2fd538e122b44,
+		0xe7d34c64a9c85d44, 0x60dbbca87196b616,
+		0x90e40fbeea1d3a4a, 0xbc8955e946fe31cd,
+		0xb51d13aea4a488dd, 0x6babab6398bdbe41,
+		0xe264589a4dcdab14, 0xc696963c7eed2dd1,
+		0x8d7eb76070a08aec, 0xfc1e1de5cf543ca2,
+		0xb0de65388cc8ada8, 0x3b25a55f43294bcb,
+		0xdd15fe86affad912, 0x49ef0eb713f39ebe,
+		0x8a2dbf142dfcc7ab, 0x6e3569326c784337,
+		0xacb92ed9397bf996, 0x49c2c37f07965404,
+		0xd7e77a8f87daf7fb, 0xdc33745ec97be906,
+		0x86f0ac99b4e8dafd, 0x69a028bb3ded71a3,
+		0xa8acd7c0222311bc, 0xc40832ea0d68ce0c,
+		0xd2d80db02aabd62b, 0xf50a3fa490c30190,
+		0x83c7088e1aab65db, 0x792667c6da79e0fa,
+		0xa4b8cab1a1563f52, 0x577001b891185938,
+		0xcde6fd5e09abcf26, 0xed4c0226b55e6f86,
+		0x80b05e5ac60b6178, 0x544f8158315b05b4,
+		0xa0dc75f1778e39d6, 0x696361ae3db1c721,
+		0xc913936dd571c84c, 0x03bc3a19cd1e38e9,
+		0xfb5878494ace3a5f, 0x04ab48a04065c723,
+		0x9d174b2dcec0e47b, 0x62eb0d64283f9c76,
+		0xc45d1df942711d9a, 0x3ba5d0bd324f8394,
+		0xf5746577930d6500, 0xca8f44ec7ee36479,
+		0x9968bf6abbe85f20, 0x7e998b13cf4e1ecb,
+		0xbfc2ef456ae276e8, 0x9e3fedd8c321a67e,
+		0xefb3ab16c59b14a2, 0xc5cfe94ef3ea101e,
+		0x95d04aee3b80ece5, 0xbba1f1d158724a12,
+		0xbb445da9ca61281f, 0x2a8a6e45ae8edc97,
+		0xea1575143cf97226, 0xf52d09d71a3293bd,
+		0x924d692ca61be758, 0x593c2626705f9c56,
+		0xb6e0c377cfa2e12e, 0x6f8b2fb00c77836c,
+		0xe498f455c38b997a, 0x0b6dfb9c0f956447,
+		0x8edf98b59a373fec, 0x4724bd4189bd5eac,
+		0xb2977ee300c50fe7, 0x58edec91ec2cb657,
+		0xdf3d5e9bc0f653e1, 0x2f2967b66737e3ed,
+		0x8b865b215899f46c, 0xbd79e0d20082ee74,
+		0xae67f1e9aec07187, 0xecd8590680a3aa11,
+		0xda01ee641a708de9, 0xe80e6f4820cc9495,
+		0x884134fe908658b2, 0x3109058d147fdcdd,
+		0xaa51823e34a7eede, 0xbd4b46f0599fd415,
+		0xd4e5e2cdc1d1ea96, 0x6c9e18ac7007c91a,
+		0x850fadc09923329e, 0x03e2cf6bc604ddb0,
+		0xa6539930bf6bff45, 0x84db8346b786151c,
+		0xcfe87f7cef46ff16, 0xe612641865679a63,
+		0x81f14fae158c5f6e, 0x4fcb7e8f3f60c07e,
+		0xa26da3999aef7749, 0xe3be5e330f38f09d,
+		0xcb090c8001ab551c, 0x5cadf5bfd3072cc5,
+		0xfdcb4fa002162a63, 0x73d9732fc7c8f7f6,
+		0x9e9f11c4014dda7e, 0x2867e7fddcdd9afa,
+		0xc646d63501a1511d, 0xb281e1fd541501b8,
+		0xf7d88bc24209a565, 0x1f225a7ca91a4226,
+		0x9ae757596946075f, 0x3375788de9b06958,
+		0xc1a12d2fc3978937, 0x0052d6b1641c83ae,
+		0xf209787bb47d6b84, 0xc0678c5dbd23a49a,
+		0x9745eb4d50ce6332, 0xf840b7ba963646e0,
+		0xbd176620a501fbff, 0xb650e5a93bc3d898,
+		0xec5d3fa8ce427aff, 0xa3e51f138ab4cebe,
+		0x93ba47c980e98cdf, 0xc66f336c36b10137,
+		0xb8a8d9bbe123f017, 0xb80b0047445d4184,
+		0xe6d3102ad96cec1d, 0xa60dc059157491e5,
+		0x9043ea1ac7e41392, 0x87c89837ad68db2f,
+		0xb454e4a179dd1877, 0x29babe4598c311fb,
+		0xe16a1dc9d8545e94, 0xf4296dd6fef3d67a,
+		0x8ce2529e2734bb1d, 0x1899e4a65f58660c,
+		0xb01ae745b101e9e4, 0x5ec05dcff72e7f8f,
+		0xdc21a1171d42645d, 0x76707543f4fa1f73,
+		0x899504ae72497eba, 0x6a06494a791c53a8,
+		0xabfa45da0edbde69, 0x0487db9d17636892,
+		0xd6f8d7509292d603, 0x45a9d2845d3c42b6,
+		0x865b86925b9bc5c2, 0x0b8a2392ba45a9b2,
+		0xa7f26836f282b732, 0x8e6cac7768d7141e,
+		0xd1ef0244af2364ff, 0x3207d795430cd926,
+		0x8335616aed761f1f, 0x7f44e6bd49e807b8,
+		0xa402b9c5a8d3a6e7, 0x5f16206c9c6209a6,
+		0xcd036837130890a1, 0x36dba887c37a8c0f,
+		0x802221226be55a64, 0xc2494954da2c9789,
+		0xa02aa96b06deb0fd, 0xf2db9baa10b7bd6c,
+		0xc83553c5c8965d3d, 0x6f92829494e5acc7,
+		0xfa42a8b73abbf48c, 0xcb772339ba1f17f9,
+		0x9c69a97284b578d7, 0xff2a760414536efb,
+		0xc38413cf25e2d70d, 0xfef5138519684aba,
+		0xf46518c2ef5b8cd1, 0x7eb258665fc25d69,
+		0x98bf2f79d5993802, 0xef2f773ffbd97a61,
+		0xbeeefb584aff8603, 0xaafb550ffacfd8fa,
+		0xeeaaba2e5dbf6784, 0x95ba2a53f983cf38,
+		0x952ab45cfa97a0b2, 0xdd945a747bf26183,
+		0xba756174393d88df, 0x94f971119aeef9e4,
+		0xe912b9d1478ceb17, 0x7a37cd5601aab85d,
+		0x91abb422ccb812ee, 0xac62e055c10ab33a,
+		0xb616a12b7fe617aa, 0x577b986b314d6009,
+		0xe39c49765fdf9d94, 0xed5a7e85fda0b80b,
+		0x8e41ade9fbebc27d, 0x14588f13be847307,
+		0xb1d219647ae6b31c, 0x596eb2d8ae258fc8,
+		0xde469fbd99a05fe3, 0x6fca5f8ed9aef3bb,
+		0x8aec23d680043bee, 0x25de7bb9480d5854,
+		0xada72ccc20054ae9, 0xaf561aa79a10ae6a,
+		0xd910f7ff28069da4, 0x1b2ba1518094da04,
+		0x87aa9aff79042286, 0x90fb44d2f05d0842,
+		0xa99541bf57452b28, 0x353a1607ac744a53,
+		0xd3fa922f2d1675f2, 0x42889b8997915ce8,
+		0x847c9b5d7c2e09b7, 0x69956135febada11,
+		0xa59bc234db398c25, 0x43fab9837e699095,
+		0xcf02b2c21207ef2e, 0x94f967e45e03f4bb,
+		0x8161afb94b44f57d, 0x1d1be0eebac278f5,
+		0xa1ba1ba79e1632dc, 0x6462d92a69731732,
+		0xca28a291859bbf93, 0x7d7b8f7503cfdcfe,
+		0xfcb2cb35e702af78, 0x5cda735244c3d43e,
+		0x9defbf01b061adab, 0x3a0888136afa64a7,
+		0xc56baec21c7a1916, 0x088aaa1845b8fdd0,
+		0xf6c69a72a3989f5b, 0x8aad549e57273d45,
+		0x9a3c2087a63f6399, 0x36ac54e2f678864b,
+		0xc0cb28a98fcf3c7f, 0x84576a1bb416a7dd,
+		0xf0fdf2d3f3c30b9f, 0x656d44a2a11c51d5,
+		0x969eb7c47859e743, 0x9f644ae5a4b1b325,
+		0xbc4665b596706114, 0x873d5d9f0dde1fee,
+		0xeb57ff22fc0c7959, 0xa90cb506d155a7ea,
+		0x9316ff75dd87cbd8, 0x09a7f12442d588f2,
+		0xb7dcbf5354e9bece, 0x0c11ed6d538aeb2f,
+		0xe5d3ef282a242e81, 0x8f1668c8a86da5fa,
+		0x8fa475791a569d10, 0xf96e017d694487bc,
+		0xb38d92d760ec4455, 0x37c981dcc395a9ac,
+		0xe070f78d3927556a, 0x85bbe253f47b1417,
+		0x8c469ab843b89562, 0x93956d7478ccec8e,
+		0xaf58416654a6babb, 0x387ac8d1970027b2,
+		0xdb2e51bfe9d0696a, 0x06997b05fcc0319e,
+		0x88fcf317f22241e2, 0x441fece3bdf81f03,
+		0xab3c2fddeeaad25a, 0xd527e81cad7626c3,
+		0xd60b3bd56a5586f1, 0x8a71e223d8d3b074,
+		0x85c7056562757456, 0xf6872d5667844e49,
+		0xa738c6bebb12d16c, 0xb428f8ac016561db,
+		0xd106f86e69d785c7, 0xe13336d701beba52,
+		0x82a45b450226b39c, 0xecc0024661173473,
+		0xa34d721642b06084, 0x27f002d7f95d0190,
+		0xcc20ce9bd35c78a5, 0x31ec038df7b441f4,
+		0xff290242c83396ce, 0x7e67047175a15271,
+		0x9f79a169bd203e41, 0x0f0062c6e984d386,
+		0xc75809c42c684dd1, 0x52c07b78a3e60868,
+		0xf92e0c3537826145, 0xa7709a56ccdf8a82,
+		0x9bbcc7a142b17ccb, 0x88a66076400bb691,
+		0xc2abf989935ddbfe, 0x6acff893d00ea435,
+		0xf356f7ebf83552fe, 0x0583f6b8c4124d43,
+		0x98165af37b2153de, 0xc3727a337a8b704a,
+		0xbe1bf1b059e9a8d6, 0x744f18c0592e4c5c,
+		0xeda2ee1c7064130c, 0x1162def06f79df73,
+		0x9485d4d1c63e8be7, 0x8addcb5645ac2ba8,
+		0xb9a74a0637ce2ee1, 0x6d953e2bd7173692,
+		0xe8111c87c5c1ba99, 0xc8fa8db6ccdd0437,
+		0x910ab1d4db9914a0, 0x1d9c9892400a22a2,
+		0xb54d5e4a127f59c8, 0x2503beb6d00cab4b,
+		0xe2a0b5dc971f303a, 0x2e44ae64840fd61d,
+		0x8da471a9de737e24, 0x5ceaecfed289e5d2,
+		0xb10d8e1456105dad, 0x7425a83e872c5f47,
+		0xdd50f1996b947518, 0xd12f124e28f77719,
+		0x8a5296ffe33cc92f, 0x82bd6b70d99aaa6f,
+		0xace73cbfdc0bfb7b, 0x636cc64d1001550b,
+		0xd8210befd30efa5a, 0x3c47f7e05401aa4e,
+		0x8714a775e3e95c78, 0x65acfaec34810a71,
+		0xa8d9d1535ce3b396, 0x7f1839a741a14d0d,
+		0xd31045a8341ca07c, 0x1ede48111209a050,
+		0x83ea2b892091e44d, 0x934aed0aab460432,
+		0xa4e4b66b68b65d60, 0xf81da84d5617853f,
+		0xce1de40642e3f4b9, 0x36251260ab9d668e,
+		0x80d2ae83e9ce78f3, 0xc1d72b7c6b426019,
+		0xa1075a24e4421730, 0xb24cf65b8612f81f,
+		0xc94930ae1d529cfc, 0xdee033f26797b627,
+		0xfb9b7cd9a4a7443c, 0x169840ef017da3b1,
+		0x9d412e0806e88aa5, 0x8e1f289560ee864e,
+		0xc491798a08a2ad4e, 0xf1a6f2bab92a27e2,
+		0xf5b5d7ec8acb58a2, 0xae10af696774b1db,
+		0x9991a6f3d6bf1765, 0xacca6da1e0a8ef29,
+		0xbff610b0cc6edd3f, 0x17fd090a58d32af3,
+		0xeff394dcff8a948e, 0xddfc4b4cef07f5b0,
+		0x95f83d0a1fb69cd9, 0x4abdaf101564f98e,
+		0xbb764c4ca7a4440f, 0x9d6d1ad41abe37f1,
+		0xea53df5fd18d5513, 0x84c86189216dc5ed,
+		0x92746b9be2f8552c, 0x32fd3cf5b4e49bb4,
+		0xb7118682dbb66a77, 0x3fbc8c33221dc2a1,
+		0xe4d5e82392a40515, 0x0fabaf3feaa5334a,
+		0x8f05b1163ba6832d, 0x29cb4d87f2a7400e,
+		0xb2c71d5bca9023f8, 0x743e20e9ef511012,
+		0xdf78e4b2bd342cf6, 0x914da9246b255416,
+		0x8bab8eefb6409c1a, 0x1ad089b6c2f7548e,
+		0xae9672aba3d0c320, 0xa184ac2473b529b1,
+		0xda3c0f568cc4f3e8, 0xc9e5d72d90a2741e,
+		0x8865899617fb1871, 0x7e2fa67c7a658892,
+		0xaa7eebfb9df9de8d, 0xddbb901b98feeab7,
+		0xd51ea6fa85785631, 0x552a74227f3ea565,
+		0x8533285c936b35de, 0xd53a88958f87275f,
+		0xa67ff273b8460356, 0x8a892abaf368f137,
+		0xd01fef10a657842c, 0x2d2b7569b0432d85,
+		0x8213f56a67f6b29b, 0x9c3b29620e29fc73,
+		0xa298f2c501f45f42, 0x8349f3ba91b47b8f,
+		0xcb3f2f7642717713, 0x241c70a936219a73,
+		0xfe0efb53d30dd4d7, 0xed238cd383aa0110,
+		0x9ec95d1463e8a506, 0xf4363804324a40aa,
+		0xc67bb4597ce2ce48, 0xb143c6053edcd0d5,
+		0xf81aa16fdc1b81da, 0xdd94b7868e94050a,
+		0x9b10a4e5e9913128, 0xca7cf2b4191c8326,
+		0xc1d4ce1f63f57d72, 0xfd1c2f611f63a3f0,
+		0xf24a01a73cf2dccf, 0xbc633b39673c8cec,
+		0x976e41088617ca01, 0xd5be0503e085d813,
+		0xbd49d14aa79dbc82, 0x4b2d8644d8a74e18,
+		0xec9c459d51852ba2, 0xddf8e7d60ed1219e,
+		0x93e1ab8252f33b45, 0xcabb90e5c942b503,
+		0xb8da1662e7b00a17, 0x3d6a751f3b936243,
+		0xe7109bfba19c0c9d, 0x0cc512670a783ad4,
+		0x906a617d450187e2, 0x27fb2b80668b24c5,
+		0xb484f9dc9641e9da, 0xb1f9f660802dedf6,
+		0xe1a63853bbd26451, 0x5e7873f8a0396973,
+		0x8d07e33455637eb2, 0xdb0b487b6423e1e8,
+		0xb049dc016abc5e5f, 0x91ce1a9a3d2cda62,
+		0xdc5c5301c56b75f7, 0x7641a140cc7810fb,
+		0x89b9b3e11b6329ba, 0xa9e904c87fcb0a9d,
+		0xac2820d9623bf429, 0x546345fa9fbdcd44,
+		0xd732290fbacaf133, 0xa97c177947ad4095,
+		0x867f59a9d4bed6c0, 0x49ed8eabcccc485d,
+		0xa81f301449ee8c70, 0x5c68f256bfff5a74,
+		0xd226fc195c6a2f8c, 0x73832eec6fff3111,
+		0x83585d8fd9c25db7, 0xc831fd53c5ff7eab,
+		0xa42e74f3d032f525, 0xba3e7ca8b77f5e55,
+		0xcd3a1230c43fb26f, 0x28ce1bd2e55f35eb,
+		0x80444b5e7aa7cf85, 0x7980d163cf5b81b3,
+		0xa0555e361951c366, 0xd7e105bcc332621f,
+		0xc86ab5c39fa63440, 0x8dd9472bf3fefaa7,
+		0xfa856334878fc150, 0xb14f98f6f0feb951,
+		0x9c935e00d4b9d8d2, 0x6ed1bf9a569f33d3,
+		0xc3b8358109e84f07, 0x0a862f80ec4700c8,
+		0xf4a642e14c6262c8, 0xcd27bb612758c0fa,
+		0x98e7e9cccfbd7dbd, 0x8038d51cb897789c,
+		0xbf21e44003acdd2c, 0xe0470a63e6bd56c3,
+		0xeeea5d5004981478, 0x1858ccfce06cac74,
+		0x95527a5202df0ccb, 0x0f37801e0c43ebc8,
+		0xbaa718e68396cffd, 0xd30560258f54e6ba,
+		0xe950df20247c83fd, 0x47c6b82ef32a2069,
+		0x91d28b7416cdd27e, 0x4cdc331d57fa5441,
+		0xb6472e511c81471d, 0xe0133fe4adf8e952,
+		0xe3d8f9e563a198e5, 0x58180fddd97723a6,
+		0x8e679c2f5e44ff8f, 0x570f09eaa7ea7648,
+	};
+	inline void __full_multiplication( std::uint64_t a, std::uint64_t b, std::uint64_t & high, std::uint64_t & low )
+	{
+#if defined( __SIZEOF_INT128__ )
+		unsigned __int128 r = static_cast< unsigned __int128 >( a ) * b;
+		high = static_cast< std::uint64_t >( r >> 64 );
+		low = static_cast< std::uint64_t >( r );
+#elif defined( _MSC_VER ) && defined( _M_X64 )
+		low = _umul128( a, b, &high );
+#else
+		std::uint64_t a_lo = a & 0xFFFFFFFF, a_hi = a >> 32, b_lo = b & 0xFFFFFFFF, b_hi = b >> 32;
+		std::uint64_t lo_lo = a_lo * b_lo, hi_lo = a_hi * b_lo, lo_hi = a_lo * b_hi, hi_hi = a_hi * b_hi;
+		std::uint64_t cross = ( lo_lo >> 32 ) + ( hi_lo & 0xFFFFFFFF ) + lo_hi;
+		high = ( hi_lo >> 32 ) + ( cross >> 32 ) + hi_hi;
+		low = ( cross << 32 ) | ( lo_lo & 0xFFFFFFFF );
+#endif
+	}
+	inline std::uint32_t __clz64( std::uint64_t val )
+	{
+#if defined( _MSC_VER ) && !defined( __clang__ )
+		unsigned long index;
+		_BitScanReverse64( &index, val );
+		return 63 - index;
+#else
+		return __builtin_clzll( val );
+#endif
+	}
+	inline bool __is_eight_digits( const char * str )
+	{
+		std::uint64_t val;
+		std::memcpy( &val, str, sizeof( val ) );
+
+		return ( ( val & 0xF0F0F0F0F0F0F0F0 ) | ( ( ( val + 0x0606060606060606 ) & 0xF0F0F0F0F0F0F0F0 ) >> 4 ) ) == 0x3333333333333333;
+	}
+	inline std::uint32_t __parse_eight_digits( const char * str )
+	{
+		std::uint64_t val;
+		std::memcpy( &val, str, sizeof( val ) );
+
+		val -= 0x3030303030303030;
+		val = ( val * 10 ) + ( val >> 8 );
+		val = ( ( ( val & 0x000000FF000000FF ) * 0x000F424000000064 ) + ( ( ( val >> 16 ) & 0x000000FF000000FF ) * 0x0000271000000001 ) ) >> 32;
+
+		return static_cast< std::uint32_t >( val );
+	}
+	inline const char * __parse_digits( const char * str, const char * end, std::uint64_t & val )
+	{
+#if !defined( __BYTE_ORDER__ ) || __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+		while ( end - str >= 8 && __is_eight_digits( str ) )
 		{
-			return std::visit( overloaded{
-				[]( double val ) -> float { return static_cast<float>( val ); },
-				[]( std::int64_t val ) -> float { return static_cast<float>( val ); },
-				[]( std::uint64_t val ) -> float { return static_cast<float>( val ); },
-				}, _value );
+			val = val * 100000000 + __parse_eight_digits( str );
+			str += 8;
 		}
-
-		operator double() const
+#endif
+		while ( str != end && *str >= '0' && *str <= '9' )
 		{
-			return std::visit( overloaded{
-				[]( double val ) -> double { return static_cast<double>( val ); },
-				[]( std::int64_t val ) -> double { return static_cast<double>( val ); },
-				[]( std::uint64_t val ) -> double { return static_cast<double>( val ); },
-				}, _value );
+			val = val * 10 + static_cast< std::uint64_t >( *str++ - '0' );
 		}
 
-		operator std::int8_t() const
+		return str;
+	}
+	inline bool __eisel_lemire( std::uint64_t w, std::int64_t q, bool negative, double & result )
+	{
+		if ( w == 0 || q < -342 )
 		{
-			return std::visit( overloaded{
-				[]( double val ) -> std::int8_t { return static_cast<std::int8_t>( val ); },
-				[]( std::int64_t val ) -> std::int8_t { return static_cast<std::int8_t>( val ); },
-				[]( std::uint64_t val ) -> std::int8_t { return static_cast<std::int8_t>( val ); },
-				}, _value );
+			result = negative ? -0.0 : 0.0;
+			return true;
 		}
+		if ( q > 308 ) return false;
 
-		operator std::int16_t() const
+		std::uint32_t lz = __clz64( w );
+		w <<= lz;
+
+		std::uint64_t high, low;
+		std::size_t index = 2 * static_cast< std::size_t >( q + 342 );
+		__full_multiplication( w, __power_of_five_128[index], high, low );
+		if ( ( high & 0x1FF ) == 0x1FF )
 		{
-			return std::visit( overloaded{
-				[]( double val ) -> std::int16_t { return static_cast<std::int16_t>( val ); },
-				[]( std::int64_t val ) -> std::int16_t { return static_cast<std::int16_t>( val ); },
-				[]( std::uint64_t val ) -> std::int16_t { return static_cast<std::int16_t>( val ); },
-				}, _value );
+			std::uint64_t high2, low2;
+			__full_multiplication( w, __power_of_five_128[index + 1], high2, low2 );
+
+			low += high2;
+			if ( high2 > low ) high++;
+			if ( low == 0xFFFFFFFFFFFFFFFF ) return false;
 		}
 
-		operator std::int32_t() const
+		std::uint64_t upperbit = high >> 63;
+		std::uint64_t mantissa = high >> ( upperbit + 9 );
+		lz += static_cast< std::uint32_t >( 1 ^ upperbit );
+
+		std::int64_t exponent = ( ( ( 152170 + 65536 ) * q ) >> 16 ) + 1024 + 63 - lz;
+		if ( exponent <= 0 )
 		{
-			return std::visit( overloaded{
-				[]( double val ) -> std::int32_t { return static_cast<std::int32_t>( val ); },
-				[]( std::int64_t val ) -> std::int32_t { return static_cast<std::int32_t>( val ); },
-				[]( std::uint64_t val ) -> std::int32_t { return static_cast<std::int32_t>( val ); },
-				}, _value );
+			if ( -exponent + 1 >= 64 )
+			{
+				result = negative ? -0.0 : 0.0;
+				return true;
+			}
+
+			mantissa >>= -exponent + 1;
+			mantissa += ( mantissa & 1 );
+			mantissa >>= 1;
+			exponent = ( mantissa < ( std::uint64_t( 1 ) << 52 ) ) ? 0 : 1;
 		}
+		else
+		{
+			if ( low <= 1 && q >= -4 && q <= 23 && ( mantissa & 3 ) == 1 )
+			{
+				if ( ( mantissa << ( upperbit + 9 ) ) == high ) mantissa &= ~std::uint64_t( 1 );
+			}
 
-		operator std::int64_t() const
+			mantissa += ( mantissa & 1 );
+			mantissa >>= 1;
+			if ( mantissa >= ( std::uint64_t( 1 ) << 53 ) )
+			{
+				mantissa = std::uint64_t( 1 ) << 52;
+				exponent++;
+			}
+			mantissa &= ~( std::uint64_t( 1 ) << 52 );
+			if ( exponent > 2046 ) return false;
+		}
+
+		std::uint64_t bits = mantissa | ( static_cast< std::uint64_t >( exponent ) << 52 ) | ( static_cast< std::uint64_t >( negative ) << 63 );
+		std::memcpy( &result, &bits, sizeof( result ) );
+		return true;
+	}
+	inline const char * __parse_number( const char * str, const char * end, std::variant< double, std::int64_t, std::uint64_t > & result, bool * out_of_range = nullptr )
+	{
+		static constexpr double powers[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+
+		const char * begin = str;
+		bool negative = ( str != end && *str == '-' );
+		if ( negative ) ++str;
+
+		const char * int_begin = str;
+		std::uint64_t w = 0;
+		if ( str == end || *str < '0' || *str > '9' ) return nullptr;
+		if ( *str == '0' )
 		{
-			return std::visit( overloaded{
-				[]( double val ) -> std::int64_t { return static_cast<std::int64_t>( val ); },
-				[]( std::int64_t val ) -> std::int64_t { return static_cast<std::int64_t>( val ); },
-				[]( std::uint64_t val ) -> std::int64_t { return static_cast<std::int64_t>( val ); },
-				}, _value );
+			++str;
+			if ( str != end && *str >= '0' && *str <= '9' ) return nullptr;
+		}
+		else
+		{
+			str = __parse_digits( str, end, w );
 		}
+		const char * int_end = str;
 
-		operator std::uint8_t() const
+		bool is_float = false;
+		const char * frac_begin = str, * frac_end = str;
+		if ( str != end && *str == '.' )
 		{
-			return std::visit( overloaded{
-				[]( double val ) -> std::uint8_t { return static_cast<std::uint8_t>( val ); },
-				[]( std::int64_t val ) -> std::uint8_t { return static_cast<std::uint8_t>( val ); },
-				[]( std::uint64_t val ) -> std::uint8_t { return static_cast<std::uint8_t>( val ); },
-				}, _value );
+			is_float = true;
+			frac_begin = ++str;
+			str = __parse_digits( str, end, w );
+			frac_end = str;
+			if ( frac_begin == frac_end ) return nullptr;
 		}
 
-		operator std::uint16_t() const
+		std::int64_t exp_number = 0;
+		if ( str != end && ( *str == 'e' || *str == 'E' ) )
 		{
-			return std::visit( overloaded{
-				[]( double val ) -> std::uint16_t { return static_cast<std::uint16_t>( val ); },
-				[]( std::int64_t val ) -> std::uint16_t { return static_cast<std::uint16_t>( val ); },
-				[]( std::uint64_t val ) -> std::uint16_t { return static_cast<std::uint16_t>( val ); },
-				}, _value );
+			is_float = true;
+			++str;
+
+			bool exp_negative = false;
+			if ( str != end && ( *str == '-' || *str == '+' ) ) exp_negative = ( *str++ == '-' );
+			if ( str == end || *str < '0' || *str > '9' ) return nullptr;
+
+			while ( str != end && *str >= '0' && *str <= '9' )
+			{
+				if ( exp_number < 0x10000000 ) exp_number = exp_number * 10 + ( *str - '0' );
+				++str;
+			}
+			if ( exp_negative ) exp_number = -exp_number;
 		}
 
-		operator std::uint32_t() const
+		if ( !is_float )
 		{
-			return std::visit( overloaded{
-				[]( double val ) -> std::uint32_t { return static_cast<std::uint32_t>( val ); },
+			std::int64_t int_digits = int_end - int_begin;
+			if ( int_digits < 20 || ( int_digits == 20 && *int_begin == '1' && w >= 10000000000000000000ull ) )
+			{
+				if ( !negative )
+				{
+					if ( w <= static_cast< std::uint64_t >( std::numeric_limits< std::int64_t >::max() ) )
+						result = static_cast< std::int64_t >( w );
+					else
+						result = w;
+					return str;
+				}
+				if ( w <= std::uint64_t( 1 ) << 63 )
+				{
+					result = static_cast< std::int64_t >( ~w + 1 );
+					return str;
+				}
+			}
+		}
+
+		std::int64_t digit_count = ( int_end - int_begin ) + ( frac_end - frac_begin );
+		std::int64_t exponent = exp_number - ( frac_end - frac_begin );
+		bool truncated = false;
+		if ( digit_count > 19 )
+		{
+			const char * p = int_begin;
+			while ( p != frac_end && ( *p == '0' || *p == '.' ) ) digit_count -= ( *p++ == '0' );
+
+			if ( digit_count > 19 )
+			{
+				truncated = true;
+				w = 0;
+				p = int_begin;
+				while ( w < 1000000000000000000 && p != int_end ) w = w * 10 + static_cast< std::uint64_t >( *p++ - '0' );
+				if ( w >= 1000000000000000000 )
+				{
+					exponent = ( int_end - p ) + exp_number;
+				}
+				else
+				{
+					p = frac_begin;
+					while ( w < 1000000000000000000 && p != frac_end ) w = w * 10 + static_cast< std::uint64_t >( *p++ - '0' );
+					exponent = ( frac_begin - p ) + exp_number;
+				}
+			}
+		}
+
+		double d;
+		if ( !truncated && w <= ( std::uint64_t( 1 ) << 53 ) && exponent >= -22 && exponent <= 22 )
+		{
+			d = static_cast< double >( w );
+			d = exponent < 0 ? d / powers[-exponent] : d * powers[exponent];
+			result = negative ? -d : d;
+			return str;
+		}
+
+		if ( __eisel_lemire( w, exponent, negative, d ) )
+		{
+			double check;
+			if ( !truncated || ( __eisel_lemire( w + 1, exponent, negative, check ) && check == d ) )
+			{
+				result = d;
+				return str;
+			}
+		}
+
+		auto r = std::from_chars( begin, str, d );
+		if ( r.ec == std::errc::result_out_of_range )
+		{
+			if ( out_of_range == nullptr ) JSONHPP_THROW( std::out_of_range( "number out of range!" ) );
+
+			*out_of_range = true;
+			return nullptr;
+		}
+		if ( r.ec != std::errc() || r.ptr != str ) return nullptr;
+
+		result = d;
+		return str;
+	}
+	inline bool __is_number_char( char c )
+	{
+		return ( c >= '0' && c <= '9' ) || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E';
+	}
+
+	template<> class element< jsonhpp::type::null >
+	{
+	public:
+		static constexpr jsonhpp::type value_t = jsonhpp::type::null;
+
+	public:
+		element() = default;
+
+		element( element && ) = default;
+
+		element( const element & ) = default;
+
+		element( std::pmr::memory_resource * ){}
+
+		element & operator= ( element && ) = default;
+
+		element & operator= ( const element & ) = default;
+
+	public:
+		jsonhpp::type get_type() const
+		{
+			return value_t;
+		}
+
+	public:
+		template< typename T > void read( istream_wrapper< T > & stream )
+		{
+			if ( !__stream_match( stream, "null" ) ) JSONHPP_THROW( std::invalid_argument( "is not \'null\'!" ) );
+		}
+
+		template< typename T > void write( ostream_wrapper< T > & stream, std::uint32_t depth, std::uint32_t tab = 0, bool /*ascii*/ = false ) const
+		{
+			__stream_puts( stream, "null" );
+		}
+	};
+	template<> class element< jsonhpp::type::array >;
+	template<> class element< jsonhpp::type::string >
+	{
+	public:
+		static constexpr jsonhpp::type value_t = jsonhpp::type::string;
+
+	public:
+		element( element && ) = default;
+
+		element( const element & ) = default;
+
+		element & operator= ( element && ) = default;
+
+		element & operator= ( const element & ) = default;
+
+		element( std::pmr::memory_resource * resource )
+			:_value( resource )
+		{
+
+		}
+
+		element( std::pmr::memory_resource * resource, const char * str )
+			:_value( str, resource )
+		{
+
+		}
+
+		element( std::pmr::memory_resource * resource, std::string_view str )
+			:_value( str.data(), str.size(), resource )
+		{
+
+		}
+
+		template< typename A > element( std::pmr::memory_resource * resource, const std::basic_string< char, std::char_traits< char >, A > & str )
+			: _value( str.data(), str.size(), resource )
+		{
+
+		}
+
+		element & operator= ( const char * str )
+		{
+			_view = {};
+			_value = str;
+			return *this;
+		}
+
+		element & operator= ( std::string_view str )
+		{
+			_view = {};
+			_value.assign( str.data(), str.size() );
+
+			return *this;
+		}
+
+		template< typename A > element & operator= ( const std::basic_string< char, std::char_traits< char >, A > & str )
+		{
+			_view = {};
+			_value.assign( str.data(), str.size() );
+			return *this;
+		}
+
+	public:
+		operator const char * ( ) const
+		{
+			return c_str();
+		}
+
+		operator std::string_view() const
+		{
+			if ( _view.data() != nullptr ) return _view;
+
+			return { _value.data(), _value.size() };
+		}
+
+		// views are never copied behind a const reference, convert through std::string_view instead
+		operator const std::pmr::string & ( ) const
+		{
+			if ( _view.data() != nullptr ) JSONHPP_THROW( std::logic_error( "string is a view!" ) );
+
+			return _value;
+		}
+
+		template< typename A > operator std::basic_string< char, std::char_traits< char >, A >() const
+		{
+			std::string_view str = *this;
+
+			return { str.begin(), str.end() };
+		}
+
+		friend bool operator==( const element & left, const element & right )
+		{
+			return std::string_view( left ) == std::string_view( right );
+		}
+
+		friend bool operator==( const element & left, std::string_view right )
+		{
+			return std::string_view( left ) == right;
+		}
+
+		friend bool operator==( const element & left, const char * right )
+		{
+			return std::string_view( left ) == right;
+		}
+
+		friend bool operator!=( const element & left, std::string_view right )
+		{
+			return std::string_view( left ) != right;
+		}
+
+		friend bool operator!=( const element & left, const char * right )
+		{
+			return std::string_view( left ) != right;
+		}
+
+	public:
+		const char * c_str() const
+		{
+			if ( _view.data() == nullptr ) return _value.c_str();
+			if ( _view.data()[_view.size()] != '\0' ) JSONHPP_THROW( std::logic_error( "string is a view!" ) );
+
+			return _view.data();
+		}
+
+		const char * data() const
+		{
+			return std::string_view( *this ).data();
+		}
+
+		std::size_t size() const
+		{
+			return std::string_view( *this ).size();
+		}
+
+		std::size_t length() const
+		{
+			return size();
+		}
+
+		bool empty() const
+		{
+			return size() == 0;
+		}
+
+		const char * begin() const
+		{
+			return data();
+		}
+
+		const char * end() const
+		{
+			return data() + size();
+		}
+
+		char operator[]( std::size_t pos ) const
+		{
+			return data()[pos];
+		}
+
+	public:
+		jsonhpp::type get_type() const
+		{
+			return value_t;
+		}
+
+		bool is_view() const
+		{
+			return _view.data() != nullptr;
+		}
+
+		void assign_view( std::string_view str )
+		{
+			// str must stay alive and be followed by '\0' for as long as this string refers to it
+			_value.clear();
+			_view = str;
+		}
+
+	public:
+		template< typename T > void read( istream_wrapper< T > & stream )
+		{
+			if constexpr ( std::is_same_v< T, char * > )
+			{
+				if ( stream.insitu() )
+				{
+					_view = __read_string_insitu( stream, _value );
+					return;
+				}
+			}
+
+			__read_string( stream, _value );
+		}
+
+		template< typename T > void write( ostream_wrapper< T > & stream, std::uint32_t depth, std::uint32_t tab = 0, bool ascii = false ) const
+		{
+			std::string_view str = *this;
+
+			__write_string( stream, str.data(), str.size(), ascii );
+		}
+
+	private:
+		std::pmr::string _value;
+		std::string_view _view;
+	};
+	template<> class element< jsonhpp::type::number >
+	{
+	public:
+		static constexpr jsonhpp::type value_t = jsonhpp::type::number;
+
+	public:
+		element( element && ) = default;
+
+		element( const element & ) = default;
+
+		element & operator= ( element && ) = default;
+
+		element & operator= ( const element & ) = default;
+
+		element( float val )
+			:_value( val )
+		{}
+
+		element( double val )
+			:_value( val )
+		{}
+
+		element( std::int8_t val )
+			:_value( std::int64_t( val ) )
+		{}
+
+		element( std::int16_t val )
+			:_value( std::int64_t( val ) )
+		{}
+
+		element( std::int32_t val )
+			:_value( std::int64_t( val ) )
+		{}
+
+		element( std::int64_t val )
+			:_value( val )
+		{}
+
+		element( std::uint8_t val )
+			:_value( std::uint64_t( val ) )
+		{}
+
+		element( std::uint16_t val )
+			:_value( std::uint64_t( val ) )
+		{}
+
+		element( std::uint32_t val )
+			:_value( std::uint64_t( val ) )
+		{}
+
+		element( std::uint64_t val )
+			:_value( val )
+		{}
+
+		element( std::pmr::memory_resource * ) {}
+
+		element & operator= ( double val )
+		{
+			_value = val;
+			return *this;
+		}
+
+		element & operator= ( std::int64_t val )
+		{
+			_value = val;
+			return *this;
+		}
+
+		element & operator= ( std::uint64_t val )
+		{
+			_value = val;
+			return *this;
+		}
+
+	public:
+		operator float() const
+		{
+			return std::visit( overloaded{
+				[]( double val ) -> float { return static_cast<float>( val ); },
+				[]( std::int64_t val ) -> float { return static_cast<float>( val ); },
+				[]( std::uint64_t val ) -> float { return static_cast<float>( val ); },
+				}, _value );
+		}
+
+		operator double() const
+		{
+			return std::visit( overloaded{
+				[]( double val ) -> double { return static_cast<double>( val ); },
+				[]( std::int64_t val ) -> double { return static_cast<double>( val ); },
+				[]( std::uint64_t val ) -> double { return static_cast<double>( val ); },
+				}, _value );
+		}
+
+		operator std::int8_t() const
+		{
+			return std::visit( overloaded{
+				[]( double val ) -> std::int8_t { return static_cast<std::int8_t>( val ); },
+				[]( std::int64_t val ) -> std::int8_t { return static_cast<std::int8_t>( val ); },
+				[]( std::uint64_t val ) -> std::int8_t { return static_cast<std::int8_t>( val ); },
+				}, _value );
+		}
+
+		operator std::int16_t() const
+		{
+			return std::visit( overloaded{
+				[]( double val ) -> std::int16_t { return static_cast<std::int16_t>( val ); },
+				[]( std::int64_t val ) -> std::int16_t { return static_cast<std::int16_t>( val ); },
+				[]( std::uint64_t val ) -> std::int16_t { return static_cast<std::int16_t>( val ); },
+				}, _value );
+		}
+
+		operator std::int32_t() const
+		{
+			return std::visit( overloaded{
+				[]( double val ) -> std::int32_t { return static_cast<std::int32_t>( val ); },
+				[]( std::int64_t val ) -> std::int32_t { return static_cast<std::int32_t>( val ); },
+				[]( std::uint64_t val ) -> std::int32_t { return static_cast<std::int32_t>( val ); },
+				}, _value );
+		}
+
+		operator std::int64_t() const
+		{
+			return std::visit( overloaded{
+				[]( double val ) -> std::int64_t { return static_cast<std::int64_t>( val ); },
+				[]( std::int64_t val ) -> std::int64_t { return static_cast<std::int64_t>( val ); },
+				[]( std::uint64_t val ) -> std::int64_t { return static_cast<std::int64_t>( val ); },
+				}, _value );
+		}
+
+		operator std::uint8_t() const
+		{
+			return std::visit( overloaded{
+				[]( double val ) -> std::uint8_t { return static_cast<std::uint8_t>( val ); },
+				[]( std::int64_t val ) -> std::uint8_t { return static_cast<std::uint8_t>( val ); },
+				[]( std::uint64_t val ) -> std::uint8_t { return static_cast<std::uint8_t>( val ); },
+				}, _value );
+		}
+
+		operator std::uint16_t() const
+		{
+			return std::visit( overloaded{
+				[]( double val ) -> std::uint16_t { return static_cast<std::uint16_t>( val ); },
+				[]( std::int64_t val ) -> std::uint16_t { return static_cast<std::uint16_t>( val ); },
+				[]( std::uint64_t val ) -> std::uint16_t { return static_cast<std::uint16_t>( val ); },
+				}, _value );
+		}
+
+		operator std::uint32_t() const
+		{
+			return std::visit( overloaded{
+				[]( double val ) -> std::uint32_t { return static_cast<std::uint32_t>( val ); },
 				[]( std::int64_t val ) -> std::uint32_t { return static_cast<std::uint32_t>( val ); },
 				[]( std::uint64_t val ) -> std::uint32_t { return static_cast<std::uint32_t>( val ); },
 				}, _value );
 		}
 
-		operator std::uint64_t() const
+		operator std::uint64_t() const
+		{
+			return std::visit( overloaded{
+				[]( double val ) -> std::uint64_t { return static_cast<std::uint64_t>( val ); },
+				[]( std::int64_t val ) -> std::uint64_t { return static_cast<std::uint64_t>( val ); },
+				[]( std::uint64_t val ) -> std::uint64_t { return static_cast<std::uint64_t>( val ); },
+				}, _value );
+		}
+
+	public:
+		jsonhpp::type get_type() const
+		{
+			return value_t;
+		}
+
+	public:
+		bool is_int() const
+		{
+			return _value.index() == 1;
+		}
+
+		bool is_uint() const
+		{
+			return _value.index() == 2;
+		}
+
+		bool is_float() const
+		{
+			return _value.index() == 0;
+		}
+
+	public:
+		template< typename T > void read( istream_wrapper< T > & stream )
+		{
+			if constexpr ( __is_contiguous_v< istream_wrapper< T > > )
+			{
+				const char * data = __stream_data( stream );
+				const char * end = data + __stream_remain( stream );
+				const char * last = __parse_number( data, end, _value );
+
+				if ( last != nullptr && last != end )
+				{
+					__stream_skip( stream, last - data );
+					return;
+				}
+			}
+
+			std::string buf;
+			while ( __is_number_char( __stream_peek( stream ) ) )
+			{
+				buf.push_back( __stream_get( stream ) );
+			}
+
+			if ( __parse_number( buf.data(), buf.data() + buf.size(), _value ) != buf.data() + buf.size() ) JSONHPP_THROW( std::invalid_argument( "invalid number!" ) );
+		}
+
+		template< typename T > void write( ostream_wrapper< T > & stream, std::uint32_t depth, std::uint32_t tab = 0, bool /*ascii*/ = false ) const
+		{
+			char buf[32] = {};
+
+			auto result = std::visit( overloaded{
+				[&buf]( double val ) { return std::to_chars( buf, buf + sizeof( buf ), val ); },
+				[&buf]( std::int64_t val ) { return std::to_chars( buf, buf + sizeof( buf ), val ); },
+				[&buf]( std::uint64_t val ) { return std::to_chars( buf, buf + sizeof( buf ), val ); },
+				}, _value );
+
+			__stream_write( stream, buf, result.ptr - buf );
+		}
+
+	private:
+		std::variant< double, std::int64_t, std::uint64_t > _value;
+	};
+	template<> class element< jsonhpp::type::object >;
+	template<> class element< jsonhpp::type::boolean >
+	{
+	public:
+		static constexpr jsonhpp::type value_t = jsonhpp::type::boolean;
+
+	public:
+		element( bool val )
+			:_value( val )
+		{}
+
+		element( element && ) = default;
+
+		element( const element & ) = default;
+
+		element( std::pmr::memory_resource * ) {}
+
+		element & operator= ( element && ) = default;
+
+		element & operator= ( const element & ) = default;
+
+		element & operator= ( bool val )
+		{
+			_value = val;
+			return *this;
+		}
+
+	public:
+		operator bool() const
+		{
+			return _value;
+		}
+
+	public:
+		jsonhpp::type get_type() const
+		{
+			return value_t;
+		}
+
+	public:
+		template< typename T > void read( istream_wrapper< T > & stream )
+		{
+			if ( __stream_peek( stream ) == 'f' )
+			{
+				if ( !__stream_match( stream, "false" ) ) JSONHPP_THROW( std::invalid_argument( "" ) );
+				_value = false;
+			}
+			else if ( __stream_peek( stream ) == 't' )
+			{
+				if( !__stream_match( stream, "true" ) ) JSONHPP_THROW( std::invalid_argument( "" ) );
+				_value = true;
+			}
+		}
+
+		template< typename T > void write( ostream_wrapper< T > & stream, std::uint32_t depth, std::uint32_t tab = 0, bool /*ascii*/ = false ) const
+		{
+			__stream_puts( stream, _value ? "true" : "false" );
+		}
+
+	private:
+		bool _value;
+	};
+	using null_t = element< jsonhpp::type::null >;
+	using array_t = element< jsonhpp::type::array >;
+	using string_t = element< jsonhpp::type::string >;
+	using number_t = element< jsonhpp::type::number >;
+	using object_t = element< jsonhpp::type::object >;
+	using boolean_t = element< jsonhpp::type::boolean >;
+
+	inline string_t * __make_string( std::pmr::memory_resource * resource, string_t && val )
+	{
+		return new ( resource->allocate( sizeof( string_t ), alignof( string_t ) ) ) string_t( std::move( val ) );
+	}
+	inline string_t * __make_string( std::pmr::memory_resource * resource, const string_t & val )
+	{
+		return new ( resource->allocate( sizeof( string_t ), alignof( string_t ) ) ) string_t( resource, std::string_view( val ) );
+	}
+	template< typename T > string_t * __make_string( std::pmr::memory_resource * resource, const T & val )
+	{
+		return new ( resource->allocate( sizeof( string_t ), alignof( string_t ) ) ) string_t( resource, val );
+	}
+
+	template< bool P = ( alignof( std::pmr::memory_resource ) >= 8 ) > class __tagged_resource
+	{
+	public:
+		__tagged_resource( std::pmr::memory_resource * resource )
+			:_bits( reinterpret_cast< std::uintptr_t >( resource ) | static_cast< std::uintptr_t >( jsonhpp::type::unknown ) )
+		{}
+
+	public:
+		std::pmr::memory_resource * resource() const
+		{
+			return reinterpret_cast< std::pmr::memory_resource * >( _bits & ~mask );
+		}
+
+		jsonhpp::type type() const
+		{
+			return static_cast< jsonhpp::type >( _bits & mask );
+		}
+
+		void set_type( jsonhpp::type val )
+		{
+			_bits = ( _bits & ~mask ) | static_cast< std::uintptr_t >( val );
+		}
+
+	private:
+		static constexpr std::uintptr_t mask = 7;
+
+		std::uintptr_t _bits;
+	};
+	template<> class __tagged_resource< false >
+	{
+	public:
+		__tagged_resource( std::pmr::memory_resource * resource )
+			:_resource( resource )
+		{}
+
+	public:
+		std::pmr::memory_resource * resource() const
+		{
+			return _resource;
+		}
+
+		jsonhpp::type type() const
+		{
+			return _type;
+		}
+
+		void set_type( jsonhpp::type val )
+		{
+			_type = val;
+		}
+
+	private:
+		std::pmr::memory_resource * _resource;
+		jsonhpp::type _type = jsonhpp::type::unknown;
+	};
+
+	class value
+	{
+	public:
+		using element_type = std::variant<
+			std::monostate,
+			null_t,
+			string_t,
+			number_t,
+			boolean_t,
+			array_t *,
+			object_t * > ;
+		using allocator_type = std::pmr::polymorphic_allocator< value >;
+
+	public:
+		value( value && val ) noexcept
+			:_tag( val.resource() )
+		{
+			take( val );
+		}
+
+		value( value && val, const allocator_type & alloc )
+			:_tag( alloc.resource() )
+		{
+			if ( resource() == val.resource() ) take( val );
+			else copy( val );
+		}
+
+		value( const value & val, const allocator_type & alloc )
+			:_tag( alloc.resource() )
+		{
+			copy( val );
+		}
+
+		// a copy never shares the source's resource, which may be an arena owned by another document
+		value( const value & val )
+			:_tag( std::pmr::get_default_resource() )
+		{
+			copy( val );
+		}
+
+		value( std::pmr::memory_resource * resource )
+			:_tag( resource )
+		{}
+
+		value( std::pmr::memory_resource * resource, const value & val )
+			:_tag( resource )
+		{
+			copy( val );
+		}
+
+		value( std::pmr::memory_resource * resource, null_t && val )
+			:_tag( resource )
+		{
+			emplace< null_t >( std::move( val ) );
+		}
+
+		value( std::pmr::memory_resource * resource, string_t && val )
+			:_tag( resource )
+		{
+			set( __make_string( resource, std::move( val ) ) );
+		}
+
+		value( std::pmr::memory_resource * resource, number_t && val )
+			:_tag( resource )
+		{
+			emplace< number_t >( std::move( val ) );
+		}
+
+		value( std::pmr::memory_resource * resource, boolean_t && val )
+			:_tag( resource )
+		{
+			emplace< boolean_t >( std::move( val ) );
+		}
+
+		value( std::pmr::memory_resource * resource, array_t * val )
+			:_tag( resource )
+		{
+			set( val );
+		}
+
+		value( std::pmr::memory_resource * resource, object_t * val )
+			:_tag( resource )
+		{
+			set( val );
+		}
+
+		value( std::pmr::memory_resource * resource, element_type && val )
+			:_tag( resource )
+		{
+			std::visit( overloaded{
+				[]( std::monostate & ) {},
+				[this]( string_t & val ) { set( __make_string( this->resource(), std::move( val ) ) ); },
+				[this]( array_t * val ) { set( val ); },
+				[this]( object_t * val ) { set( val ); },
+				[this]( auto & val ) { emplace< std::decay_t< decltype( val ) > >( std::move( val ) ); },
+				}, val );
+		}
+
+		value( std::pmr::memory_resource * resource, const element_type & val )
+			:value( resource, element_type( val ) )
+		{}
+
+		value & operator= ( value && val )
+		{
+			if ( this == &val ) return *this;
+
+			// the payload is detached first, val may live inside this tree
+			value temp( std::move( val ), allocator_type( resource() ) );
+			clear();
+			take( temp );
+
+			return *this;
+		}
+
+		value & operator= ( const value & val )
+		{
+			if ( this == &val ) return *this;
+
+			clear();
+			copy( val );
+
+			return *this;
+		}
+
+		~value()
+		{
+			clear();
+		}
+
+	public:
+		value( bool val )
+		{
+			emplace< boolean_t >( val );
+		}
+
+		value( float val )
+		{
+			emplace< number_t >( val );
+		}
+
+		value( double val )
+		{
+			emplace< number_t >( val );
+		}
+
+		value( std::nullptr_t )
+		{
+			emplace< null_t >();
+		}
+
+		value( std::int8_t val )
+		{
+			emplace< number_t >( val );
+		}
+
+		value( std::int16_t val )
+		{
+			emplace< number_t >( val );
+		}
+
+		value( std::int32_t val )
+		{
+			emplace< number_t >( val );
+		}
+
+		value( std::int64_t val )
+		{
+			emplace< number_t >( val );
+		}
+
+		value( std::uint8_t val )
+		{
+			emplace< number_t >( val );
+		}
+
+		value( std::uint16_t val )
+		{
+			emplace< number_t >( val );
+		}
+
+		value( std::uint32_t val )
+		{
+			emplace< number_t >( val );
+		}
+
+		value( std::uint64_t val )
+		{
+			emplace< number_t >( val );
+		}
+
+		value( const char * str )
+		{
+			set( __make_string( resource(), str ) );
+		}
+
+		value( std::string_view str )
+		{
+			set( __make_string( resource(), str ) );
+		}
+
+		value( const std::initializer_list< value > & list )
+		{
+			bool is_obj = false;
+			if ( list.size() % 2 == 0 )
+			{
+				is_obj = true;
+				for ( auto it = list.begin(); it != list.end(); it += 2 )
+				{
+					if ( !it->is_string() )
+					{
+						is_obj = false;
+						break;
+					}
+				}
+			}
+
+			if ( is_obj )
+				set( __make_object( resource(), list ) );
+			else
+				set( __make_array( resource(), list ) );
+		}
+
+		template< typename A > value( const std::basic_string< char, std::char_traits< char >, A > & str )
+		{
+			set( __make_string( resource(), str ) );
+		}
+
+		value & operator= ( float val )
+		{
+			clear();
+			emplace< number_t >( val );
+			return *this;
+		}
+
+		value & operator= ( double val )
+		{
+			clear();
+			emplace< number_t >( val );
+			return *this;
+		}
+
+		value & operator= ( std::nullptr_t )
+		{
+			clear();
+			emplace< null_t >();
+			return *this;
+		}
+
+		value & operator= ( std::int8_t val )
+		{
+			clear();
+			emplace< number_t >( val );
+			return *this;
+		}
+
+		value & operator= ( std::int16_t val )
+		{
+			clear();
+			emplace< number_t >( val );
+			return *this;
+		}
+
+		value & operator= ( std::int32_t val )
+		{
+			clear();
+			emplace< number_t >( val );
+			return *this;
+		}
+
+		value & operator= ( std::int64_t val )
+		{
+			clear();
+			emplace< number_t >( val );
+			return *this;
+		}
+
+		value & operator= ( std::uint8_t val )
+		{
+			clear();
+			emplace< number_t >( val );
+			return *this;
+		}
+
+		value & operator= ( std::uint16_t val )
+		{
+			clear();
+			emplace< number_t >( val );
+			return *this;
+		}
+
+		value & operator= ( std::uint32_t val )
+		{
+			clear();
+			emplace< number_t >( val );
+			return *this;
+		}
+
+		value & operator= ( std::uint64_t val )
+		{
+			clear();
+			emplace< number_t >( val );
+			return *this;
+		}
+
+		value & operator= ( const char * str )
+		{
+			clear();
+			set( __make_string( resource(), str ) );
+			return *this;
+		}
+
+		value & operator= ( std::string_view str )
+		{
+			clear();
+			set( __make_string( resource(), str ) );
+			return *this;
+		}
+
+		template< typename A > value & operator= ( const std::basic_string< char, std::char_traits< char >, A > & str )
+		{
+			clear();
+			set( __make_string( resource(), str ) );
+			return *this;
+		}
+
+		value & operator= ( const std::initializer_list< value > & list )
+		{
+			clear();
+
+			bool is_obj = false;
+			if ( list.size() % 2 == 0 )
+			{
+				is_obj = true;
+				for ( auto it = list.begin(); it != list.end(); it += 2 )
+				{
+					if ( !it->is_string() )
+					{
+						is_obj = false;
+						break;
+					}
+				}
+			}
+
+			if ( is_obj )
+				set( __make_object( resource(), list ) );
+			else
+				set( __make_array( resource(), list ) );
+
+			return *this;
+		}
+
+	public:
+		value & operator[]( std::size_t val );
+
+		value & operator[]( std::string_view val );
+
+	public:
+		void swap( value & val )
+		{
+			if ( resource() == val.resource() )
+			{
+				std::swap( _data, val._data );
+				std::swap( _tag, val._tag );
+				return;
+			}
+
+			value left( val.resource(), *this );
+			value right( resource(), val );
+
+			clear();
+			take( right );
+			val.clear();
+			val.take( left );
+		}
+
+	public:
+		type get_type() const
+		{
+			return _tag.type();
+		}
+
+		std::pmr::memory_resource * resource() const
+		{
+			return _tag.resource();
+		}
+
+	public:
+		bool empty() const
+		{
+			return get_type() == jsonhpp::type::unknown;
+		}
+
+		bool is_null() const
+		{
+			return get_type() == jsonhpp::type::null;
+		}
+
+		bool is_array() const
+		{
+			return get_type() == jsonhpp::type::array;
+		}
+
+		bool is_string() const
+		{
+			return get_type() == jsonhpp::type::string;
+		}
+
+		bool is_number() const
+		{
+			return get_type() == jsonhpp::type::number;
+		}
+
+		bool is_object() const
+		{
+			return get_type() == jsonhpp::type::object;
+		}
+
+		bool is_boolean() const
+		{
+			return get_type() == jsonhpp::type::boolean;
+		}
+
+	public:
+		null_t & get_null()
+		{
+			return get< null_t >( jsonhpp::type::null );
+		}
+
+		array_t & get_array()
+		{
+			return *get< array_t * >( jsonhpp::type::array );
+		}
+
+		string_t & get_string()
+		{
+			return *get< string_t * >( jsonhpp::type::string );
+		}
+
+		number_t & get_number()
+		{
+			return get< number_t >( jsonhpp::type::number );
+		}
+
+		object_t & get_object()
+		{
+			return *get< object_t * >( jsonhpp::type::object );
+		}
+
+		boolean_t & get_boolean()
+		{
+			return get< boolean_t >( jsonhpp::type::boolean );
+		}
+
+	public:
+		const null_t & get_null() const
+		{
+			return const_cast< value * >( this )->get_null();
+		}
+
+		const array_t & get_array() const
+		{
+			return const_cast< value * >( this )->get_array();
+		}
+
+		const string_t & get_string() const
+		{
+			return const_cast< value * >( this )->get_string();
+		}
+
+		const number_t & get_number() const
+		{
+			return const_cast< value * >( this )->get_number();
+		}
+
+		const object_t & get_object() const
+		{
+			return const_cast< value * >( this )->get_object();
+		}
+
+		const boolean_t & get_boolean() const
+		{
+			return const_cast< value * >( this )->get_boolean();
+		}
+
+	public:
+		void set_null()
+		{
+			clear();
+			emplace< null_t >();
+		}
+
+		void set_int( std::int64_t val )
+		{
+			clear();
+			emplace< number_t >( val );
+		}
+
+		void set_uint( std::uint64_t val )
+		{
+			clear();
+			emplace< number_t >( val );
+		}
+
+		void set_float( double val )
+		{
+			clear();
+			emplace< number_t >( val );
+		}
+
+		void set_string( const char * str )
+		{
+			clear();
+			set( __make_string( resource(), str ) );
+		}
+
+		void set_string( std::string_view str )
+		{
+			clear();
+			set( __make_string( resource(), str ) );
+		}
+
+		template< typename A > void set_string( const std::basic_string< char, std::char_traits< char >, A > & str )
+		{
+			clear();
+			set( __make_string( resource(), str ) );
+		}
+
+		void set_array( std::initializer_list< value > list )
+		{
+			clear();
+			set( __make_array( resource(), list ) );
+		}
+
+		void set_object( std::initializer_list< value > list )
+		{
+			clear();
+			set( __make_object( resource(), list ) );
+		}
+
+	public:
+		void clear();
+
+	protected:
+		void forget()
+		{
+			_tag.set_type( jsonhpp::type::unknown );
+		}
+
+	private:
+		template< typename T > T & get( jsonhpp::type type )
+		{
+			if ( get_type() != type ) JSONHPP_THROW( std::bad_variant_access() );
+
+			return *std::launder( reinterpret_cast< T * >( _data ) );
+		}
+
+		template< typename T, typename ... Args > void emplace( Args && ... args )
+		{
+			new ( _data ) T( std::forward< Args >( args )... );
+			_tag.set_type( T::value_t );
+		}
+
+		template< typename T > void set( T * val )
+		{
+			new ( _data ) T * ( val );
+			_tag.set_type( T::value_t );
+		}
+
+		template< typename T > void destroy( T * val )
+		{
+			val->~T();
+			resource()->deallocate( val, sizeof( T ), alignof( T ) );
+		}
+
+		void take( value & val ) noexcept
+		{
+			std::memcpy( _data, val._data, sizeof( _data ) );
+			_tag.set_type( val.get_type() );
+			val.forget();
+		}
+
+		void copy( const value & val )
+		{
+			// nested containers are queued instead of copied recursively, so nesting does not consume call frames
+			std::vector< std::pair< const value *, value * > > pending;
+			const value * from = &val;
+			value * to = this;
+			while ( true )
+			{
+				switch ( from->get_type() )
+				{
+				case jsonhpp::type::string:
+					to->set( __make_string( to->resource(), from->get_string() ) );
+					break;
+				case jsonhpp::type::array:
+					to->set( __copy_array( to->resource(), &const_cast< value * >( from )->get_array(), pending ) );
+					break;
+				case jsonhpp::type::object:
+					to->set( __copy_object( to->resource(), &const_cast< value * >( from )->get_object(), pending ) );
+					break;
+				default:
+					std::memcpy( to->_data, from->_data, sizeof( _data ) );
+					to->_tag.set_type( from->get_type() );
+					break;
+				}
+
+				if ( pending.empty() ) break;
+				from = pending.back().first;
+				to = pending.back().second;
+				pending.pop_back();
+			}
+		}
+
+	private:
+		static_assert( std::is_trivially_copyable_v< null_t > && std::is_trivially_copyable_v< number_t > && std::is_trivially_copyable_v< boolean_t >, "scalars are copied bitwise" );
+
+		// scalars live in the cell, strings and containers are allocated from the resource
+		alignas( number_t ) unsigned char _data[sizeof( number_t )] = {};
+		__tagged_resource<> _tag = std::pmr::get_default_resource();
+	};
+
+	template<> class element< jsonhpp::type::array >
+	{
+	public:
+		static constexpr jsonhpp::type value_t = jsonhpp::type::array;
+
+	public:
+		using size_type = std::size_t;
+		using value_type = jsonhpp::value;
+		using container_type = std::pmr::vector< value_type >;
+		using iterator = typename container_type::iterator;
+		using const_iterator = typename container_type::const_iterator;
+
+	public:
+		element() = default;
+
+		element( std::pmr::memory_resource * resource )
+			:_value( resource )
+		{}
+
+	public:
+		jsonhpp::type get_type() const
+		{
+			return value_t;
+		}
+
+	public:
+		value_type & operator[]( size_type val )
+		{
+			return _value[val];
+		}
+
+		const value_type & operator[]( size_type val ) const
+		{
+			return _value[val];
+		}
+
+	public:
+		size_type size() const
+		{
+			return _value.size();
+		}
+
+		void reserve( size_type val )
+		{
+			_value.reserve( val );
+		}
+
+		iterator earse( const_iterator val )
+		{
+			return _value.erase( val );
+		}
+
+		void push_back( const value_type & val )
+		{
+			_value.push_back( val );
+		}
+
+		void push_back( value_type && val )
+		{
+			_value.push_back( std::move( val ) );
+		}
+
+	public:
+		iterator begin()
+		{
+			return _value.begin();
+		}
+
+		iterator end()
+		{
+			return _value.end();
+		}
+
+		const_iterator begin() const
+		{
+			return _value.begin();
+		}
+
+		const_iterator end() const
+		{
+			return _value.end();
+		}
+
+	public:
+		template< typename T > void write( ostream_wrapper< T > & stream, std::uint32_t depth, std::uint32_t tab = 0, bool ascii = false ) const
+		{
+			__stream_puts( stream, "[" );
+			for ( size_t i = 0; i < _value.size(); i++ )
+			{
+				if ( tab != 0 ) __stream_put( stream, '\n' );
+				__stream_put_tab( stream, depth + 1, tab );
+
+				__write_value( _value[i], stream, depth + 1, tab, ascii );
+
+				if ( i + 1 < _value.size() )
+				{
+					__stream_put( stream, ',' );
+				}
+			}
+
+			if ( tab != 0 ) __stream_put( stream, '\n' );
+			__stream_put_tab( stream, depth, tab );
+			__stream_puts( stream, "]" );
+		}
+
+	private:
+		container_type _value;
+	};
+	class interned_key
+	{
+	public:
+		operator std::string_view() const
+		{
+			return _text;
+		}
+
+		std::size_t hash() const
+		{
+			return _hash;
+		}
+
+	private:
+		interned_key( std::string_view text, std::size_t hash )
+			:_text( text ), _hash( hash )
+		{}
+
+	private:
+		std::string_view _text;
+		std::size_t _hash;
+
+		friend class key_pool;
+	};
+	template<> class element< jsonhpp::type::object >
+	{
+	public:
+		static constexpr jsonhpp::type value_t = jsonhpp::type::object;
+
+	public:
+		using size_type = std::size_t;
+		using value_type = jsonhpp::value;
+		using key_type = jsonhpp::string_t;
+		using container_type = std::pmr::vector< std::pair< key_type, value_type > >;
+		using iterator = typename container_type::iterator;
+		using const_iterator = typename container_type::const_iterator;
+
+	public:
+		element() = default;
+
+		element( std::pmr::memory_resource * resource )
+			:_value( resource ), _index( resource )
+		{}
+
+	public:
+		jsonhpp::type get_type() const
+		{
+			return value_t;
+		}
+
+	public:
+		value_type & operator[] ( std::string_view key )
+		{
+			size_type pos = position( key );
+			if ( pos != npos )
+			{
+				return _value[pos].second;
+			}
+
+			_value.push_back( { key_type{ _value.get_allocator().resource(), key }, value_type( _value.get_allocator().resource() ) } );
+			indexed();
+
+			return _value.back().second;
+		}
+
+		const value_type & operator[] ( std::string_view key ) const
+		{
+			size_type pos = position( key );
+			if ( pos == npos ) JSONHPP_THROW( std::out_of_range( "key not found!" ) );
+
+			return _value[pos].second;
+		}
+
+		// a missing key is inserted as a view into the key's pool, which must outlive this object
+		value_type & operator[] ( const interned_key & key )
+		{
+			size_type pos = position( key, key.hash() );
+			if ( pos != npos )
+			{
+				return _value[pos].second;
+			}
+
+			key_type name( _value.get_allocator().resource() );
+			name.assign_view( key );
+
+			_value.push_back( { std::move( name ), value_type( _value.get_allocator().resource() ) } );
+			indexed();
+
+			return _value.back().second;
+		}
+
+		const value_type & operator[] ( const interned_key & key ) const
+		{
+			size_type pos = position( key, key.hash() );
+			if ( pos == npos ) JSONHPP_THROW( std::out_of_range( "key not found!" ) );
+
+			return _value[pos].second;
+		}
+
+	public:
+		size_type size() const
+		{
+			return _value.size();
+		}
+
+		void reserve( size_type val )
+		{
+			_value.reserve( val );
+		}
+
+		iterator earse( const_iterator val )
+		{
+			iterator it = _value.erase( val );
+			rebuild();
+
+			return it;
+		}
+
+		void insert( std::string_view key, const value_type & val )
+		{
+			_value.push_back( { key_type{ _value.get_allocator().resource(), key }, val } );
+			indexed();
+		}
+
+		void insert( key_type && key, value_type && val )
+		{
+			_value.emplace_back( std::move( key ), std::move( val ) );
+			indexed();
+		}
+
+		iterator find( std::string_view key )
+		{
+			size_type pos = position( key );
+
+			return pos != npos ? _value.begin() + pos : _value.end();
+		}
+
+		const_iterator find( std::string_view key ) const
+		{
+			size_type pos = position( key );
+
+			return pos != npos ? _value.begin() + pos : _value.end();
+		}
+
+		iterator find( const interned_key & key )
+		{
+			size_type pos = position( key, key.hash() );
+
+			return pos != npos ? _value.begin() + pos : _value.end();
+		}
+
+		const_iterator find( const interned_key & key ) const
+		{
+			size_type pos = position( key, key.hash() );
+
+			return pos != npos ? _value.begin() + pos : _value.end();
+		}
+
+	public:
+		iterator begin()
+		{
+			return _value.begin();
+		}
+
+		iterator end()
+		{
+			return _value.end();
+		}
+
+		const_iterator begin() const
+		{
+			return _value.begin();
+		}
+
+		const_iterator end() const
+		{
+			return _value.end();
+		}
+
+	public:
+		template< typename T > void write( ostream_wrapper< T > & stream, std::uint32_t depth, std::uint32_t tab = 0, bool ascii = false ) const
+		{
+			__stream_puts( stream, "{" );
+			for ( size_t i = 0; i < _value.size(); i++ )
+			{
+				if ( tab != 0 ) __stream_put( stream, '\n' );
+				__stream_put_tab( stream, depth + 1, tab );
+
+				_value[i].first.write( stream, depth + 1, tab, ascii );
+
+				if ( tab != 0 ) __stream_put( stream, ' ' );
+				__stream_put( stream, ':' );
+				if ( tab != 0 ) __stream_put( stream, ' ' );
+
+				__write_value( _value[i].second, stream, depth + 1, tab, ascii );
+
+				if ( i + 1 < _value.size() )
+				{
+					__stream_put( stream, ',' );
+				}
+			}
+
+			if ( tab != 0 ) __stream_put( stream, '\n' );
+			__stream_put_tab( stream, depth, tab );
+			__stream_puts( stream, "}" );
+		}
+
+	private:
+		static constexpr size_type npos = static_cast< size_type >( -1 );
+
+		static bool same( std::string_view stored, std::string_view key )
+		{
+			// keys read through a key_pool share storage with interned_key lookups, so those hits skip the byte comparison
+			if ( stored.size() != key.size() ) return false;
+			return stored.data() == key.data() || stored == key;
+		}
+
+		size_type position( std::string_view key ) const
+		{
+			return position( key, _index.empty() ? 0 : std::hash< std::string_view >()( key ) );
+		}
+
+		size_type position( std::string_view key, std::size_t hash ) const
+		{
+			if ( _index.empty() )
+			{
+				for ( size_type i = 0; i < _value.size(); i++ )
+				{
+					if ( same( _value[i].first, key ) ) return i;
+				}
+
+				return npos;
+			}
+
+			std::size_t mask = _index.size() - 1;
+			for ( std::size_t i = hash & mask; _index[i] != 0; i = ( i + 1 ) & mask )
+			{
+				if ( same( _value[_index[i] - 1].first, key ) ) return _index[i] - 1;
+			}
+
+			return npos;
+		}
+
+		void indexed()
+		{
+			if ( _value.size() < JSONHPP_OBJECT_INDEX_THRESHOLD ) return;
+
+			if ( _index.size() < _value.size() * 2 ) rebuild();
+			else place( _value.size() - 1 );
+		}
+
+		void rebuild()
+		{
+			_index.clear();
+			if ( _value.size() < JSONHPP_OBJECT_INDEX_THRESHOLD ) return;
+
+			std::size_t size = 64;
+			while ( size < _value.size() * 4 ) size *= 2;
+
+			_index.assign( size, 0 );
+			for ( size_type i = 0; i < _value.size(); i++ )
+			{
+				place( i );
+			}
+		}
+
+		void place( size_type pos )
+		{
+			std::size_t mask = _index.size() - 1;
+			std::size_t i = std::hash< std::string_view >()( _value[pos].first ) & mask;
+			while ( _index[i] != 0 ) i = ( i + 1 ) & mask;
+
+			_index[i] = static_cast< std::uint32_t >( pos + 1 );
+		}
+
+	private:
+		container_type _value;
+		// open addressing table of positions + 1 into _value, built once the object reaches JSONHPP_OBJECT_INDEX_THRESHOLD keys
+		std::pmr::vector< std::uint32_t > _index;
+	};
+
+	inline value & value::operator[]( std::size_t val )
+	{
+		return get_array()[val];
+	}
+
+	inline value & value::operator[]( std::string_view val )
+	{
+		return get_object()[val];
+	}
+
+	inline void value::clear()
+	{
+		// containers are torn down depth first over an explicit stack, so nesting does not consume call frames
+		std::vector< std::pair< value *, std::size_t > > stack;
+		value * node = this;
+		std::size_t next = 0;
+		while ( true )
+		{
+			value * child = nullptr;
+			if ( node->get_type() == jsonhpp::type::array )
+			{
+				array_t & array = *node->get< array_t * >( jsonhpp::type::array );
+				for ( ; next < array.size() && child == nullptr; next++ )
+				{
+					if ( array[next].is_array() || array[next].is_object() ) child = &array[next];
+				}
+			}
+			else if ( node->get_type() == jsonhpp::type::object )
+			{
+				object_t & object = *node->get< object_t * >( jsonhpp::type::object );
+				for ( ; next < object.size() && child == nullptr; next++ )
+				{
+					value & val = ( object.begin() + next )->second;
+					if ( val.is_array() || val.is_object() ) child = &val;
+				}
+			}
+
+			if ( child != nullptr )
+			{
+				stack.emplace_back( node, next );
+				node = child;
+				next = 0;
+				continue;
+			}
+
+			switch ( node->get_type() )
+			{
+			case jsonhpp::type::string:
+				node->destroy( node->get< string_t * >( jsonhpp::type::string ) );
+				break;
+			case jsonhpp::type::array:
+				node->destroy( node->get< array_t * >( jsonhpp::type::array ) );
+				break;
+			case jsonhpp::type::object:
+				node->destroy( node->get< object_t * >( jsonhpp::type::object ) );
+				break;
+			default:
+				break;
+			}
+			node->_tag.set_type( jsonhpp::type::unknown );
+
+			if ( stack.empty() ) break;
+			node = stack.back().first;
+			next = stack.back().second;
+			stack.pop_back();
+		}
+	}
+
+	struct arena_t
+	{
+		explicit arena_t() = default;
+	};
+	inline constexpr arena_t arena{};
+
+	class key_pool
+	{
+	public:
+		key_pool( std::pmr::memory_resource * resource = std::pmr::get_default_resource() )
+			:_arena( resource ), _keys( resource )
+		{}
+
+		key_pool( key_pool && ) = delete;
+		key_pool( const key_pool & ) = delete;
+		key_pool & operator= ( key_pool && ) = delete;
+		key_pool & operator= ( const key_pool & ) = delete;
+
+	public:
+		// the handle keeps the key's hash, so lookups through it skip hashing and usually byte comparison too
+		interned_key intern( std::string_view key )
+		{
+			auto it = _keys.find( key );
+			if ( it == _keys.end() )
+			{
+				char * data = static_cast< char * >( _arena.allocate( key.size() + 1, 1 ) );
+				std::memcpy( data, key.data(), key.size() );
+				data[key.size()] = '\0';
+
+				it = _keys.emplace( std::string_view( data, key.size() ), std::hash< std::string_view >()( key ) ).first;
+			}
+
+			return { it->first, it->second };
+		}
+
+		std::size_t size() const
+		{
+			return _keys.size();
+		}
+
+	private:
+		std::pmr::monotonic_buffer_resource _arena;
+		std::pmr::unordered_map< std::string_view, std::size_t > _keys;
+	};
+
+	class document : public value
+	{
+	public:
+		using value::value;
+		using value::value::operator=;
+
+		document( document && ) = delete;
+		document( const document & ) = delete;
+		document & operator= ( document && ) = delete;
+		document & operator= ( const document & ) = delete;
+
+		document( std::pmr::memory_resource * resource = std::pmr::get_default_resource() )
+			:value( resource )
+		{}
+
+		// values moved out keep pointing into the arena and must not outlive the document or a reset();
+		// copies are made in the default resource and are independent of it
+		document( jsonhpp::arena_t, std::size_t size = 0 )
+			:document( std::make_unique< std::pmr::monotonic_buffer_resource >( std::max< std::size_t >( size, 4096 ) ) )
+		{}
+
+		document( jsonhpp::value && val )
+			:value( std::move( val ) )
+		{}
+
+		document( const jsonhpp::value & val )
+			:value( val )
+		{}
+
+		~document()
+		{
+			discard();
+		}
+
+	public:
+		bool owns_arena() const
+		{
+			return _arena != nullptr;
+		}
+
+		void reset()
+		{
+			discard();
+
+			if ( _arena ) _arena->release();
+		}
+
+	private:
+		document( std::unique_ptr< std::pmr::monotonic_buffer_resource > && arena )
+			:value( arena.get() ), _arena( std::move( arena ) )
+		{}
+
+		void discard()
+		{
+			// everything allocated through the arena goes away with it, so the tree is not walked
+			if ( _arena != nullptr && resource() == _arena.get() ) forget();
+			else clear();
+		}
+
+	private:
+		std::unique_ptr< std::pmr::monotonic_buffer_resource > _arena;
+	};
+
+	class event_handler
+	{
+	public:
+		bool on_null()
+		{
+			return true;
+		}
+
+		bool on_bool( bool /*val*/ )
+		{
+			return true;
+		}
+
+		bool on_number( const number_t & /*val*/ )
+		{
+			return true;
+		}
+
+		bool on_string( std::string_view /*val*/ )
+		{
+			return true;
+		}
+
+		bool on_key( std::string_view /*val*/ )
+		{
+			return true;
+		}
+
+		bool on_start_object()
+		{
+			return true;
+		}
+
+		bool on_end_object( std::size_t /*size*/ )
+		{
+			return true;
+		}
+
+		bool on_start_array()
+		{
+			return true;
+		}
+
+		bool on_end_array( std::size_t /*size*/ )
+		{
+			return true;
+		}
+	};
+
+	template< typename T > value __read_value( std::pmr::memory_resource * resource, istream_wrapper< T > & stream, read_stack & stack, std::uint32_t max_depth, key_pool * pool )
+	{
+		auto make = [&]( auto && element )
+		{
+			element.read( stream );
+
+			return value( resource, std::move( element ) );
+		};
+
+		std::pmr::string buf;
+		stack.clear();
+		value result( resource );
+		value * target = &result;
+		while ( true )
+		{
+			bool closed = false;
+
+			__stream_ignore( stream );
+			switch ( __stream_peek( stream ) )
+			{
+			case 'n':
+				*target = make( null_t( resource ) );
+				break;
+			case '\"':
+				*target = make( string_t( resource ) );
+				break;
+			case '-': case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7': case '8': case '9':
+				*target = make( number_t( resource ) );
+				break;
+			case 'f': case 't':
+				*target = make( boolean_t( resource ) );
+				break;
+			case '[':
+			{
+				if ( stack.size() >= max_depth ) JSONHPP_THROW( std::length_error( "nesting too deep!" ) );
+
+				array_t * array = new ( resource->allocate( sizeof( array_t ), alignof( array_t ) ) ) array_t( resource );
+				*target = value( resource, array );
+
+				__stream_get( stream );
+				__stream_ignore( stream );
+				if ( __stream_check( stream, ']' ) )
+				{
+					closed = true;
+				}
+				else
+				{
+					stack.push_back( { array, nullptr } );
+					array->push_back( value( resource ) );
+					target = &( *array )[array->size() - 1];
+					continue;
+				}
+			}
+			break;
+			case '{':
+			{
+				if ( stack.size() >= max_depth ) JSONHPP_THROW( std::length_error( "nesting too deep!" ) );
+
+				object_t * object = new ( resource->allocate( sizeof( object_t ), alignof( object_t ) ) ) object_t( resource );
+				*target = value( resource, object );
+
+				__stream_get( stream );
+				__stream_ignore( stream );
+				if ( __stream_check( stream, '}' ) )
+				{
+					closed = true;
+				}
+				else
+				{
+					stack.push_back( { nullptr, object } );
+				}
+			}
+			break;
+			default:
+				JSONHPP_THROW( std::invalid_argument( "unknown character" ) );
+			}
+
+			bool key = !closed && target->is_object();
+			while ( !key && !stack.empty() )
+			{
+				__read_frame & top = stack.back();
+
+				__stream_ignore( stream );
+				char c = __stream_get( stream );
+
+				if ( c == ',' )
+				{
+					if ( top.array != nullptr )
+					{
+						top.array->push_back( value( resource ) );
+						target = &( *top.array )[top.array->size() - 1];
+						break;
+					}
+					key = true;
+				}
+				else if ( ( c == ']' && top.array != nullptr ) || ( c == '}' && top.object != nullptr ) )
+				{
+					stack.pop_back();
+				}
+				else
+				{
+					JSONHPP_THROW( std::invalid_argument( "not matched \',\'" ) );
+				}
+			}
+
+			if ( key )
+			{
+				object_t * object = stack.back().object;
+				string_t name( resource );
+
+				__stream_ignore( stream );
+				if ( __stream_peek( stream ) != '\"' ) JSONHPP_THROW( std::invalid_argument( "not matched key" ) );
+				if ( pool == nullptr ) name.read( stream );
+				else
+				{
+					std::string_view text;
+					if constexpr ( std::is_same_v< T, char * > )
+					{
+						// a null view means the key was unescaped into buf
+						text = __read_string_insitu( stream, buf );
+					}
+					else
+					{
+						buf.clear();
+						__read_string( stream, buf );
+					}
+					if ( text.data() == nullptr ) text = { buf.data(), buf.size() };
+
+					name.assign_view( pool->intern( text ) );
+				}
+
+				__stream_ignore( stream );
+				if ( !__stream_check( stream, ':' ) ) JSONHPP_THROW( std::invalid_argument( "not matched \':\'" ) );
+
+				object->insert( std::move( name ), value( resource ) );
+				target = &( object->end() - 1 )->second;
+				continue;
+			}
+
+			if ( stack.empty() ) break;
+		}
+
+		return result;
+	}
+	template< typename T > value __read_value( std::pmr::memory_resource * resource, istream_wrapper< T > & stream, std::uint32_t max_depth, key_pool * pool )
+	{
+		read_stack stack;
+
+		return __read_value( resource, stream, stack, max_depth, pool );
+	}
+	template< typename T, typename H > bool __parse_events( istream_wrapper< T > & stream, H & handler, std::uint32_t max_depth )
+	{
+		struct frame
+		{
+			bool array;
+			std::size_t count;
+		};
+
+		std::pmr::string buf;
+		auto text = [&]() -> std::string_view
+		{
+			if constexpr ( std::is_same_v< T, char * > )
+			{
+				std::string_view view = __read_string_insitu( stream, buf );
+				if ( view.data() != nullptr ) return view;
+			}
+			else
+			{
+				buf.clear();
+				__read_string( stream, buf );
+			}
+
+			return { buf.data(), buf.size() };
+		};
+
+		std::vector< frame > stack;
+		while ( true )
+		{
+			bool key = false;
+
+			__stream_ignore( stream );
+			switch ( __stream_peek( stream ) )
+			{
+			case 'n':
+			{
+				null_t result;
+				result.read( stream );
+				if ( !handler.on_null() ) return false;
+			}
+			break;
+			case '\"':
+				if ( !handler.on_string( text() ) ) return false;
+				break;
+			case '-': case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7': case '8': case '9':
+			{
+				number_t result( nullptr );
+				result.read( stream );
+				if ( !handler.on_number( result ) ) return false;
+			}
+			break;
+			case 'f': case 't':
+			{
+				boolean_t result( false );
+				result.read( stream );
+				if ( !handler.on_bool( static_cast< bool >( result ) ) ) return false;
+			}
+			break;
+			case '[':
+			{
+				if ( stack.size() >= max_depth ) JSONHPP_THROW( std::length_error( "nesting too deep!" ) );
+
+				__stream_get( stream );
+				if ( !handler.on_start_array() ) return false;
+
+				__stream_ignore( stream );
+				if ( __stream_check( stream, ']' ) )
+				{
+					if ( !handler.on_end_array( 0 ) ) return false;
+				}
+				else
+				{
+					stack.push_back( { true, 0 } );
+					continue;
+				}
+			}
+			break;
+			case '{':
+			{
+				if ( stack.size() >= max_depth ) JSONHPP_THROW( std::length_error( "nesting too deep!" ) );
+
+				__stream_get( stream );
+				if ( !handler.on_start_object() ) return false;
+
+				__stream_ignore( stream );
+				if ( __stream_check( stream, '}' ) )
+				{
+					if ( !handler.on_end_object( 0 ) ) return false;
+				}
+				else
+				{
+					stack.push_back( { false, 0 } );
+					key = true;
+				}
+			}
+			break;
+			default:
+				JSONHPP_THROW( std::invalid_argument( "unknown character" ) );
+			}
+
+			while ( !key && !stack.empty() )
+			{
+				frame & top = stack.back();
+				++top.count;
+
+				__stream_ignore( stream );
+				char c = __stream_get( stream );
+
+				if ( c == ',' )
+				{
+					if ( top.array ) break;
+					key = true;
+				}
+				else if ( c == ']' && top.array )
+				{
+					std::size_t count = top.count;
+					stack.pop_back();
+					if ( !handler.on_end_array( count ) ) return false;
+				}
+				else if ( c == '}' && !top.array )
+				{
+					std::size_t count = top.count;
+					stack.pop_back();
+					if ( !handler.on_end_object( count ) ) return false;
+				}
+				else
+				{
+					JSONHPP_THROW( std::invalid_argument( "not matched \',\'" ) );
+				}
+			}
+
+			if ( key )
+			{
+				__stream_ignore( stream );
+				if ( __stream_peek( stream ) != '\"' ) JSONHPP_THROW( std::invalid_argument( "not matched key" ) );
+				if ( !handler.on_key( text() ) ) return false;
+
+				__stream_ignore( stream );
+				if ( !__stream_check( stream, ':' ) ) JSONHPP_THROW( std::invalid_argument( "not matched \':\'" ) );
+				continue;
+			}
+
+			if ( stack.empty() ) break;
+		}
+
+		return true;
+	}
+	template< typename T > void __write_value( const value & val, ostream_wrapper< T > & stream, std::uint32_t depth, std::uint32_t tab, bool ascii )
+	{
+		// open containers are kept on an explicit stack, so nesting does not consume call frames;
+		// the layout matches array_t::write and object_t::write
+		struct frame
+		{
+			const value * node;
+			std::size_t next;
+			std::uint32_t depth;
+		};
+
+		std::vector< frame > stack;
+		const value * node = &val;
+		while ( true )
+		{
+			switch ( node->get_type() )
+			{
+			case jsonhpp::type::null:
+				node->get_null().write( stream, depth, tab, ascii );
+				break;
+			case jsonhpp::type::array:
+				__stream_puts( stream, "[" );
+				stack.push_back( { node, 0, depth } );
+				break;
+			case jsonhpp::type::string:
+				node->get_string().write( stream, depth, tab, ascii );
+				break;
+			case jsonhpp::type::number:
+				node->get_number().write( stream, depth, tab, ascii );
+				break;
+			case jsonhpp::type::object:
+				__stream_puts( stream, "{" );
+				stack.push_back( { node, 0, depth } );
+				break;
+			case jsonhpp::type::boolean:
+				node->get_boolean().write( stream, depth, tab, ascii );
+				break;
+			default:
+				break;
+			}
+
+			node = nullptr;
+			while ( node == nullptr && !stack.empty() )
+			{
+				frame & top = stack.back();
+				bool object = top.node->is_object();
+				std::size_t size = object ? top.node->get_object().size() : top.node->get_array().size();
+
+				if ( top.next == size )
+				{
+					if ( tab != 0 ) __stream_put( stream, '\n' );
+					__stream_put_tab( stream, top.depth, tab );
+					__stream_puts( stream, object ? "}" : "]" );
+
+					stack.pop_back();
+					continue;
+				}
+
+				if ( top.next != 0 ) __stream_put( stream, ',' );
+				if ( tab != 0 ) __stream_put( stream, '\n' );
+				__stream_put_tab( stream, top.depth + 1, tab );
+
+				depth = top.depth + 1;
+				if ( object )
+				{
+					auto & it = *( top.node->get_object().begin() + top.next++ );
+
+					it.first.write( stream, depth, tab, ascii );
+
+					if ( tab != 0 ) __stream_put( stream, ' ' );
+					__stream_put( stream, ':' );
+					if ( tab != 0 ) __stream_put( stream, ' ' );
+
+					node = &it.second;
+				}
+				else
+				{
+					node = &top.node->get_array()[top.next++];
+				}
+			}
+
+			if ( node == nullptr ) break;
+		}
+	}
+	jsonhpp::element< jsonhpp::type::array > * __make_array( std::pmr::memory_resource * resource, const std::initializer_list< value > & list )
+	{
+		auto result = new ( resource->allocate( sizeof( array_t ), alignof( array_t ) ) ) array_t( resource );
+		for ( const auto & it : list )
+		{
+			result->push_back( it );
+		}
+		return result;
+	}
+	jsonhpp::element< jsonhpp::type::object > * __make_object( std::pmr::memory_resource * resource, const std::initializer_list< value > & list )
+	{
+		auto result = new ( resource->allocate( sizeof( object_t ), alignof( object_t ) ) ) object_t( resource );
+		for ( auto it = list.begin(); it != list.end(); it += 2 )
+		{
+			result->insert( it->get_string(), *( it + 1 ) );
+		}
+		return result;
+	}
+	// copies one level; nested containers are left empty and queued on pending, the reservation keeps their slots in place
+	jsonhpp::element< jsonhpp::type::array > * __copy_array( std::pmr::memory_resource * resource, element< type::array > * copy, std::vector< std::pair< const value *, value * > > & pending )
+	{
+		auto result = new ( resource->allocate( sizeof( array_t ), alignof( array_t ) ) ) array_t( resource );
+		result->reserve( copy->size() );
+		for ( const auto & it : *copy )
+		{
+			bool nested = it.is_array() || it.is_object();
+
+			result->push_back( nested ? value( resource ) : value( resource, it ) );
+			if ( nested ) pending.emplace_back( &it, &( *result )[result->size() - 1] );
+		}
+		return result;
+	}
+	jsonhpp::element< jsonhpp::type::object > * __copy_object( std::pmr::memory_resource * resource, element< type::object > * copy, std::vector< std::pair< const value *, value * > > & pending )
+	{
+		auto result = new ( resource->allocate( sizeof( object_t ), alignof( object_t ) ) ) object_t( resource );
+		result->reserve( copy->size() );
+		for ( const auto & it : *copy )
+		{
+			bool nested = it.second.is_array() || it.second.is_object();
+
+			result->insert( string_t( resource, std::string_view( it.first ) ), nested ? value( resource ) : value( resource, it.second ) );
+			if ( nested ) pending.emplace_back( &it.second, &( result->end() - 1 )->second );
+		}
+		return result;
+	}
+
+	struct __block_masks
+	{
+		std::uint64_t quote = 0;
+		std::uint64_t backslash = 0;
+		std::uint64_t op = 0;
+		std::uint64_t space = 0;
+	};
+	inline void __classify_block( const char * str, __block_masks & masks )
+	{
+#if defined( JSONHPP_AVX2 )
+		const __m256i quote = _mm256_set1_epi8( '\"' ), slash = _mm256_set1_epi8( '\\' ), lower = _mm256_set1_epi8( 0x20 );
+		const __m256i open = _mm256_set1_epi8( '{' ), close = _mm256_set1_epi8( '}' ), colon = _mm256_set1_epi8( ':' ), comma = _mm256_set1_epi8( ',' );
+		const __m256i space = _mm256_set1_epi8( ' ' ), n = _mm256_set1_epi8( '\n' ), r = _mm256_set1_epi8( '\r' ), t = _mm256_set1_epi8( '\t' );
+		for ( int i = 0; i < 2; i++ )
+		{
+			__m256i v = _mm256_loadu_si256( reinterpret_cast< const __m256i * >( str + i * 32 ) );
+			__m256i l = _mm256_or_si256( v, lower );
+			__m256i op = _mm256_or_si256( _mm256_or_si256( _mm256_cmpeq_epi8( l, open ), _mm256_cmpeq_epi8( l, close ) ), _mm256_or_si256( _mm256_cmpeq_epi8( v, colon ), _mm256_cmpeq_epi8( v, comma ) ) );
+			__m256i ws = _mm256_or_si256( _mm256_or_si256( _mm256_cmpeq_epi8( v, space ), _mm256_cmpeq_epi8( v, n ) ), _mm256_or_si256( _mm256_cmpeq_epi8( v, r ), _mm256_cmpeq_epi8( v, t ) ) );
+
+			masks.quote |= std::uint64_t( std::uint32_t( _mm256_movemask_epi8( _mm256_cmpeq_epi8( v, quote ) ) ) ) << ( i * 32 );
+			masks.backslash |= std::uint64_t( std::uint32_t( _mm256_movemask_epi8( _mm256_cmpeq_epi8( v, slash ) ) ) ) << ( i * 32 );
+			masks.op |= std::uint64_t( std::uint32_t( _mm256_movemask_epi8( op ) ) ) << ( i * 32 );
+			masks.space |= std::uint64_t( std::uint32_t( _mm256_movemask_epi8( ws ) ) ) << ( i * 32 );
+		}
+#elif defined( JSONHPP_SSE2 )
+		const __m128i quote = _mm_set1_epi8( '\"' ), slash = _mm_set1_epi8( '\\' ), lower = _mm_set1_epi8( 0x20 );
+		const __m128i open = _mm_set1_epi8( '{' ), close = _mm_set1_epi8( '}' ), colon = _mm_set1_epi8( ':' ), comma = _mm_set1_epi8( ',' );
+		const __m128i space = _mm_set1_epi8( ' ' ), n = _mm_set1_epi8( '\n' ), r = _mm_set1_epi8( '\r' ), t = _mm_set1_epi8( '\t' );
+		for ( int i = 0; i < 4; i++ )
+		{
+			__m128i v = _mm_loadu_si128( reinterpret_cast< const __m128i * >( str + i * 16 ) );
+			__m128i l = _mm_or_si128( v, lower );
+			__m128i op = _mm_or_si128( _mm_or_si128( _mm_cmpeq_epi8( l, open ), _mm_cmpeq_epi8( l, close ) ), _mm_or_si128( _mm_cmpeq_epi8( v, colon ), _mm_cmpeq_epi8( v, comma ) ) );
+			__m128i ws = _mm_or_si128( _mm_or_si128( _mm_cmpeq_epi8( v, space ), _mm_cmpeq_epi8( v, n ) ), _mm_or_si128( _mm_cmpeq_epi8( v, r ), _mm_cmpeq_epi8( v, t ) ) );
+
+			masks.quote |= std::uint64_t( _mm_movemask_epi8( _mm_cmpeq_epi8( v, quote ) ) ) << ( i * 16 );
+			masks.backslash |= std::uint64_t( _mm_movemask_epi8( _mm_cmpeq_epi8( v, slash ) ) ) << ( i * 16 );
+			masks.op |= std::uint64_t( _mm_movemask_epi8( op ) ) << ( i * 16 );
+			masks.space |= std::uint64_t( _mm_movemask_epi8( ws ) ) << ( i * 16 );
+		}
+#else
+		for ( int i = 0; i < 64; i++ )
+		{
+			const std::uint64_t bit = std::uint64_t( 1 ) << i;
+			switch ( str[i] )
+			{
+			case '\"': masks.quote |= bit; break;
+			case '\\': masks.backslash |= bit; break;
+			case '{': case '}': case '[': case ']': case ':': case ',': masks.op |= bit; break;
+			case ' ': case '\n': case '\r': case '\t': masks.space |= bit; break;
+			}
+		}
+#endif
+	}
+	inline std::uint32_t __ctz64( std::uint64_t val )
+	{
+#if defined( _MSC_VER ) && !defined( __clang__ )
+		unsigned long index;
+		_BitScanForward64( &index, val );
+		return index;
+#else
+		return __builtin_ctzll( val );
+#endif
+	}
+	inline bool __is_structural_end( char c )
+	{
+		return c == '\0' || c == ',' || c == ']' || c == '}' || c == ':' || __is_space( c );
+	}
+	inline void __build_index( const char * str, std::size_t size, std::vector< std::uint32_t > & index )
+	{
+		if ( size >= std::numeric_limits< std::uint32_t >::max() ) JSONHPP_THROW( std::length_error( "json too large!" ) );
+
+		index.clear();
+		index.reserve( size / 8 + 8 );
+
+		bool escaped = false;
+		std::uint64_t in_string = 0;
+		std::uint64_t prev_scalar = 0;
+
+		for ( std::size_t base = 0; base < size; base += 64 )
+		{
+			__block_masks masks;
+
+			if ( size - base >= 64 )
+			{
+				__classify_block( str + base, masks );
+			}
+			else
+			{
+				char block[64];
+				std::memset( block, ' ', sizeof( block ) );
+				std::memcpy( block, str + base, size - base );
+				__classify_block( block, masks );
+			}
+
+			std::uint64_t escaped_mask = 0;
+			std::uint64_t backslash = masks.backslash;
+			if ( escaped )
+			{
+				escaped_mask |= 1;
+				backslash &= ~std::uint64_t( 1 );
+				escaped = false;
+			}
+			while ( backslash != 0 )
+			{
+				std::uint32_t i = __ctz64( backslash );
+				if ( i == 63 )
+				{
+					escaped = true;
+					break;
+				}
+				escaped_mask |= std::uint64_t( 1 ) << ( i + 1 );
+				backslash &= ~( std::uint64_t( 3 ) << i );
+			}
+
+			std::uint64_t quote = masks.quote & ~escaped_mask;
+			std::uint64_t string_mask = quote;
+			string_mask ^= string_mask << 1;
+			string_mask ^= string_mask << 2;
+			string_mask ^= string_mask << 4;
+			string_mask ^= string_mask << 8;
+			string_mask ^= string_mask << 16;
+			string_mask ^= string_mask << 32;
+			string_mask ^= in_string;
+			in_string = std::uint64_t( std::int64_t( string_mask ) >> 63 );
+
+			std::uint64_t scalar = ~( masks.op | masks.space );
+			std::uint64_t nonquote_scalar = scalar & ~quote;
+			std::uint64_t follows_scalar = ( nonquote_scalar << 1 ) | prev_scalar;
+			prev_scalar = nonquote_scalar >> 63;
+
+			std::uint64_t structural = ( masks.op | ( scalar & ~follows_scalar ) ) & ~( string_mask ^ quote );
+			if ( size - base < 64 ) structural &= ( std::uint64_t( 1 ) << ( size - base ) ) - 1;
+
+			while ( structural != 0 )
+			{
+				index.push_back( static_cast< std::uint32_t >( base + __ctz64( structural ) ) );
+				structural &= structural - 1;
+			}
+		}
+
+		if ( in_string != 0 ) JSONHPP_THROW( std::invalid_argument( R"(unable to match "!)" ) );
+	}
+	inline void __read_indexed( value & result, const char * str, std::size_t size, const std::vector< std::uint32_t > & index, std::uint32_t max_depth )
+	{
+		struct frame
+		{
+			array_t * array;
+			object_t * object;
+		};
+
+		auto resource = result.resource();
+		std::vector< frame > stack;
+		std::size_t i = 0;
+
+		// element counts per container, in opening order, so that every container is allocated once
+		std::vector< std::uint32_t > counts;
 		{
-			return std::visit( overloaded{
-				[]( double val ) -> std::uint64_t { return static_cast<std::uint64_t>( val ); },
-				[]( std::int64_t val ) -> std::uint64_t { return static_cast<std::uint64_t>( val ); },
-				[]( std::uint64_t val ) -> std::uint64_t { return static_cast<std::uint64_t>( val ); },
-				}, _value );
+			std::vector< std::uint32_t > open;
+			for ( std::size_t k = 0; k < index.size(); k++ )
+			{
+				char c = str[index[k]];
+				if ( c == '[' || c == '{' )
+				{
+					char close = ( c == '[' ? ']' : '}' );
+					open.push_back( static_cast< std::uint32_t >( counts.size() ) );
+					counts.push_back( k + 1 < index.size() && str[index[k + 1]] == close ? 0 : 1 );
+				}
+				else if ( c == ',' && !open.empty() )
+				{
+					++counts[open.back()];
+				}
+				else if ( ( c == ']' || c == '}' ) && !open.empty() )
+				{
+					open.pop_back();
+				}
+			}
 		}
+		std::size_t opened = 0;
 
-	public:
-		jsonhpp::type get_type() const
+		auto next = [&]() -> std::size_t
 		{
-			return value_t;
-		}
+			if ( i >= index.size() ) JSONHPP_THROW( std::invalid_argument( "unexpected end!" ) );
+			return index[i++];
+		};
+		auto peek = [&]() -> char
+		{
+			return i < index.size() ? str[index[i]] : '\0';
+		};
+		// a scalar ends before the next structural character, which bounds every scan below
+		auto bound = [&]() -> const char *
+		{
+			return str + ( i < index.size() ? index[i] : size );
+		};
+		auto scalar = [&]( std::size_t pos, auto & element )
+		{
+			istream_wrapper< char * > stream( str + pos, size - pos );
 
-	public:
-		bool is_int() const
+			element.read( stream );
+			if ( element.get_type() != jsonhpp::type::string && !__is_structural_end( stream.peek() ) ) JSONHPP_THROW( std::invalid_argument( "unknown character" ) );
+		};
+		auto text = [&]( std::size_t pos )
 		{
-			return _value.index() == 1;
-		}
+			const char * data = str + pos + 1;
+			std::size_t n = __scan_string( data, bound() - data );
+			if ( data + n != bound() && data[n] == '\"' )
+			{
+				__check_utf8( data, n );
+				return string_t( resource, std::string_view( data, n ) );
+			}
 
-		bool is_uint() const
+			string_t element( resource );
+			scalar( pos, element );
+
+			return element;
+		};
+		auto number = [&]( std::size_t pos ) -> value
 		{
-			return _value.index() == 2;
-		}
+			std::variant< double, std::int64_t, std::uint64_t > parsed;
+			const char * last = __parse_number( str + pos, bound(), parsed );
+			if ( last == nullptr || ( last != bound() && !__is_structural_end( *last ) ) ) JSONHPP_THROW( std::invalid_argument( "invalid number!" ) );
 
-		bool is_float() const
+			return std::visit( [&]( auto val ) { return value( resource, number_t( val ) ); }, parsed );
+		};
+		auto make = [&]( std::size_t pos, auto && element )
 		{
-			return _value.index() == 0;
-		}
+			scalar( pos, element );
 
-	public:
-		template< typename T > void read( istream_wrapper< T > & stream )
+			return value( resource, std::move( element ) );
+		};
+
+		value * target = &result;
+		while ( true )
 		{
-			bool f = false;
-			char buf[25] = {};
-			std::uint32_t i = 0;
+			std::size_t pos = next();
+			bool closed = false;
 
-			if ( __stream_peek( stream ) == '-' )
+			switch ( str[pos] )
+			{
+			case '[':
 			{
-				buf[i++] = __stream_get( stream );
+				if ( stack.size() >= max_depth ) JSONHPP_THROW( std::length_error( "nesting too deep!" ) );
+
+				array_t * array = new ( resource->allocate( sizeof( array_t ), alignof( array_t ) ) ) array_t( resource );
+				*target = value( resource, array );
+				array->reserve( counts[opened++] );
+
+				if ( peek() == ']' )
+				{
+					++i;
+					closed = true;
+				}
+				else
+				{
+					stack.push_back( { array, nullptr } );
+					array->push_back( value( resource ) );
+					target = &( *array )[array->size() - 1];
+					continue;
+				}
 			}
-			
-			if ( __stream_peek( stream ) == '.' )
+			break;
+			case '{':
 			{
-				f = true;
-				buf[i++] = '0';
-				buf[i++] = __stream_get( stream );
-				while ( __stream_peek( stream ) >= '0' && __stream_peek( stream ) <= '9' )
+				if ( stack.size() >= max_depth ) JSONHPP_THROW( std::length_error( "nesting too deep!" ) );
+
+				object_t * object = new ( resource->allocate( sizeof( object_t ), alignof( object_t ) ) ) object_t( resource );
+				*target = value( resource, object );
+				object->reserve( counts[opened++] );
+
+				if ( peek() == '}' )
 				{
-					buf[i++] = __stream_get( stream );
+					++i;
+					closed = true;
+				}
+				else
+				{
+					stack.push_back( { nullptr, object } );
 				}
 			}
-			else
+			break;
+			case '\"':
+				*target = value( resource, text( pos ) );
+				break;
+			case 'n':
+				*target = make( pos, null_t( resource ) );
+				break;
+			case 't': case 'f':
+				*target = make( pos, boolean_t( resource ) );
+				break;
+			case '-': case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7': case '8': case '9':
+				*target = number( pos );
+				break;
+			default:
+				JSONHPP_THROW( std::invalid_argument( "unknown character" ) );
+			}
+
+			bool key = !closed && target->is_object();
+			while ( !key && !stack.empty() )
 			{
-				while ( ( __stream_peek( stream ) >= '0' && __stream_peek( stream ) <= '9' ) || __stream_peek( stream ) == '.' )
+				frame & top = stack.back();
+				char c = str[next()];
+
+				if ( c == ',' )
 				{
-					buf[i++] = __stream_get( stream );
-					if ( buf[i - 1] == '.' )
+					if ( top.array != nullptr )
 					{
-						f = true;
-						while ( __stream_peek( stream ) >= '0' && __stream_peek( stream ) <= '9' )
-						{
-							buf[i++] = __stream_get( stream );
-						}
+						top.array->push_back( value( resource ) );
+						target = &( *top.array )[top.array->size() - 1];
 						break;
 					}
+					key = true;
 				}
-			}
-
-			if ( f )
-			{
-				double val;
-				std::from_chars( buf, buf + i, val );
-				_value = val;
-			}
-			else if( buf[0] == '-' )
-			{
-				std::int64_t val;
-				std::from_chars( buf, buf + i, val );
-				_value = val;
-			}
-			else
-			{
-				if ( std::strcmp( "9223372036854775807", buf ) < 0 )
+				else if ( ( c == ']' && top.array != nullptr ) || ( c == '}' && top.object != nullptr ) )
 				{
-					std::uint64_t val;
-					std::from_chars( buf, buf + i, val );
-					_value = val;
+					stack.pop_back();
 				}
 				else
 				{
-					std::int64_t val;
-					std::from_chars( buf, buf + i, val );
-					_value = val;
+					JSONHPP_THROW( std::invalid_argument( "not matched \',\'" ) );
 				}
 			}
+
+			if ( key )
+			{
+				object_t * object = stack.back().object;
+
+				pos = next();
+				if ( str[pos] != '\"' ) JSONHPP_THROW( std::invalid_argument( "not matched key" ) );
+
+				string_t name = text( pos );
+				if ( str[next()] != ':' ) JSONHPP_THROW( std::invalid_argument( "not matched \':\'" ) );
+
+				object->insert( std::move( name ), value( resource ) );
+				target = &( object->end() - 1 )->second;
+				continue;
+			}
+
+			if ( stack.empty() ) break;
 		}
 
-		template< typename T > void write( ostream_wrapper< T > & stream, std::uint32_t depth, std::uint32_t tab = 0 ) const
+		if ( i != index.size() ) JSONHPP_THROW( std::invalid_argument( "unknown character" ) );
+	}
+
+	inline const char * __skip_string( const char * str, const char * end )
+	{
+		for ( ++str; ; )
 		{
-			char buf[25] = {};
+			str += __scan_string( str, end - str );
+			if ( str == end ) JSONHPP_THROW( std::out_of_range( "out of range" ) );
 
-			std::visit( overloaded{
-				[&buf]( double val ) { std::to_chars( buf, buf + 24, val ); },
-				[&buf]( std::int64_t val ) { std::to_chars( buf, buf + 24, val ); },
-				[&buf]( std::uint64_t val ) { std::to_chars( buf, buf + 24, val ); },
-				}, _value );
+			if ( *str == '\"' ) return str + 1;
+			if ( *str != '\\' ) JSONHPP_THROW( std::invalid_argument( "control character in string!" ) );
+			if ( end - str < 2 ) JSONHPP_THROW( std::out_of_range( "out of range" ) );
 
-			__stream_puts( stream, buf );
+			str += 2;
 		}
+	}
+	inline const char * __skip_value( const char * str, const char * end )
+	{
+		if ( str == end ) JSONHPP_THROW( std::out_of_range( "out of range" ) );
 
-	private:
-		std::variant< double, std::int64_t, std::uint64_t > _value;
-	};
-	template<> class element< jsonhpp::type::object >;
-	template<> class element< jsonhpp::type::boolean >
+		if ( *str == '\"' ) return __skip_string( str, end );
+		if ( *str != '[' && *str != '{' )
+		{
+			while ( str != end && !__is_structural_end( *str ) ) ++str;
+			return str;
+		}
+
+		for ( std::size_t depth = 0; ; )
+		{
+			str += __scan_structure( str, end - str );
+			if ( str == end ) JSONHPP_THROW( std::out_of_range( "out of range" ) );
+
+			switch ( *str )
+			{
+			case '\"':
+				str = __skip_string( str, end );
+				break;
+			case '[': case '{':
+				++depth;
+				++str;
+				break;
+			default:
+				++str;
+				if ( --depth == 0 ) return str;
+				break;
+			}
+		}
+	}
+
+	class lazy_value
 	{
 	public:
-		static constexpr jsonhpp::type value_t = jsonhpp::type::boolean;
+		lazy_value( const char * str, const char * end )
+			:_str( str + __skip_space( str, end - str ) ), _end( end )
+		{}
 
-	public:
-		element( bool val )
-			:_value( val )
+		lazy_value( std::string_view json )
+			:lazy_value( json.data(), json.data() + json.size() )
 		{}
 
-		element( element && ) = default;
+	public:
+		lazy_value operator[]( std::size_t val ) const
+		{
+			if ( get_type() != jsonhpp::type::array ) JSONHPP_THROW( std::bad_variant_access() );
 
-		element( const element & ) = default;
+			const char * str = next( _str + 1 );
+			if ( *str != ']' )
+			{
+				for ( std::size_t i = 0; ; ++i )
+				{
+					if ( i == val ) return { str, _end };
 
-		element( std::pmr::memory_resource * ) {}
+					str = next( __skip_value( str, _end ) );
+					if ( *str == ']' ) break;
+					if ( *str != ',' ) JSONHPP_THROW( std::invalid_argument( "not matched \',\'" ) );
 
-		element & operator= ( element && ) = default;
+					str = next( str + 1 );
+				}
+			}
 
-		element & operator= ( const element & ) = default;
+			JSONHPP_THROW( std::out_of_range( "index out of range!" ) );
+		}
 
-		element & operator= ( bool val )
+		lazy_value operator[]( std::string_view val ) const
 		{
-			_value = val;
-			return *this;
+			if ( get_type() != jsonhpp::type::object ) JSONHPP_THROW( std::bad_variant_access() );
+
+			std::pmr::string buf;
+			const char * str = next( _str + 1 );
+			if ( *str != '}' )
+			{
+				while ( true )
+				{
+					if ( *str != '\"' ) JSONHPP_THROW( std::invalid_argument( "not matched key" ) );
+
+					istream_wrapper< char * > stream( str, _end - str );
+					std::string_view key = __read_string_insitu( stream, buf );
+					if ( key.data() == nullptr ) key = { buf.data(), buf.size() };
+
+					str = next( stream.data() );
+					if ( *str != ':' ) JSONHPP_THROW( std::invalid_argument( "not matched \':\'" ) );
+
+					str = next( str + 1 );
+					if ( key == val ) return { str, _end };
+
+					str = next( __skip_value( str, _end ) );
+					if ( *str == '}' ) break;
+					if ( *str != ',' ) JSONHPP_THROW( std::invalid_argument( "not matched \',\'" ) );
+
+					str = next( str + 1 );
+				}
+			}
+
+			JSONHPP_THROW( std::out_of_range( "key not found!" ) );
 		}
 
 	public:
-		operator bool() const
+		jsonhpp::type get_type() const
 		{
-			return _value;
+			switch ( _str != _end ? *_str : '\0' )
+			{
+			case 'n':
+				return jsonhpp::type::null;
+			case '[':
+				return jsonhpp::type::array;
+			case '\"':
+				return jsonhpp::type::string;
+			case '-': case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7': case '8': case '9':
+				return jsonhpp::type::number;
+			case '{':
+				return jsonhpp::type::object;
+			case 'f': case 't':
+				return jsonhpp::type::boolean;
+			default:
+				return jsonhpp::type::unknown;
+			}
 		}
 
-	public:
-		jsonhpp::type get_type() const
+		std::string_view raw() const
 		{
-			return value_t;
+			return { _str, static_cast< std::size_t >( __skip_value( _str, _end ) - _str ) };
 		}
 
-	public:
-		template< typename T > void read( istream_wrapper< T > & stream )
+		std::size_t size() const
 		{
-			if ( __stream_peek( stream ) == 'f' )
-			{
-				if ( !__stream_match( stream, "false" ) ) throw std::invalid_argument( "" );
-				_value = false;
-			}
-			else if ( __stream_peek( stream ) == 't' )
+			jsonhpp::type type = get_type();
+			if ( type != jsonhpp::type::array && type != jsonhpp::type::object ) JSONHPP_THROW( std::bad_variant_access() );
+
+			const char close = type == jsonhpp::type::array ? ']' : '}';
+			const char * str = next( _str + 1 );
+			if ( *str == close ) return 0;
+
+			for ( std::size_t count = 1; ; ++count )
 			{
-				if( !__stream_match( stream, "true" ) ) throw std::invalid_argument( "" );
-				_value = true;
+				if ( type == jsonhpp::type::object )
+				{
+					str = next( __skip_string( str, _end ) );
+					if ( *str != ':' ) JSONHPP_THROW( std::invalid_argument( "not matched \':\'" ) );
+					str = next( str + 1 );
+				}
+
+				str = next( __skip_value( str, _end ) );
+				if ( *str == close ) return count;
+				if ( *str != ',' ) JSONHPP_THROW( std::invalid_argument( "not matched \',\'" ) );
+
+				str = next( str + 1 );
 			}
 		}
 
-		template< typename T > void write( ostream_wrapper< T > & stream, std::uint32_t depth, std::uint32_t tab = 0 ) const
+	public:
+		bool empty() const
 		{
-			__stream_puts( stream, _value ? "true" : "false" );
+			return get_type() == jsonhpp::type::unknown;
 		}
 
-	private:
-		bool _value;
-	};
-	template<> class element< jsonhpp::type::unknown >
-	{
-		friend class value;
-
-	public:
-		virtual ~element() = default;
-
-	protected:
-		element() = default;
+		bool is_null() const
+		{
+			return get_type() == jsonhpp::type::null;
+		}
 
-	protected:
-		virtual std::size_t get_size() const = 0;
+		bool is_array() const
+		{
+			return get_type() == jsonhpp::type::array;
+		}
 
-		virtual value & find_value( std::size_t val ) = 0;
+		bool is_string() const
+		{
+			return get_type() == jsonhpp::type::string;
+		}
 
-		virtual value & find_value( std::string_view val ) = 0;
-	};
+		bool is_number() const
+		{
+			return get_type() == jsonhpp::type::number;
+		}
 
-	using null_t = element< jsonhpp::type::null >;
-	using array_t = element< jsonhpp::type::array >;
-	using string_t = element< jsonhpp::type::string >;
-	using number_t = element< jsonhpp::type::number >;
-	using object_t = element< jsonhpp::type::object >;
-	using boolean_t = element< jsonhpp::type::boolean >;
-	using unknown_t = element< jsonhpp::type::unknown >;
+		bool is_object() const
+		{
+			return get_type() == jsonhpp::type::object;
+		}
 
-	class value
-	{
-	public:
-		using element_type = std::variant<
-			std::monostate,
-			null_t,
-			string_t,
-			number_t,
-			boolean_t,
-			array_t *,
-			object_t * > ;
+		bool is_boolean() const
+		{
+			return get_type() == jsonhpp::type::boolean;
+		}
 
 	public:
-		value( value && val )
+		null_t get_null() const
 		{
-			swap( std::forward< value & >( val ) );
+			return read( null_t(), jsonhpp::type::null );
 		}
 
-		value( const value & val )
-			:_element( val._element ), _resource( val._resource )
+		string_t get_string( std::pmr::memory_resource * resource = std::pmr::get_default_resource() ) const
 		{
-			std::visit( overloaded{
-				[this]( array_t * val ) { _element = __copy_array( _resource, val ); },
-				[this]( object_t * val ) { _element = __copy_object( _resource, val ); },
-				[]( auto & ) {}
-				}, _element );
+			return read( string_t( resource ), jsonhpp::type::string );
 		}
 
-		value( std::pmr::memory_resource * resource )
-			:_resource( resource )
-		{}
-
-		value( std::pmr::memory_resource * resource, element_type && val )
-			:_element( std::move( val ) ), _resource( resource )
-		{}
-
-		value( std::pmr::memory_resource * resource, const element_type & val )
-			:_element( val ), _resource( resource )
-		{}
+		number_t get_number() const
+		{
+			return read( number_t( nullptr ), jsonhpp::type::number );
+		}
 
-		value & operator= ( value && val )
+		boolean_t get_boolean() const
 		{
-			swap( std::forward< value & >( val ) );
-			return *this;
+			return read( boolean_t( false ), jsonhpp::type::boolean );
 		}
 
-		value & operator= ( const value & val )
+		value get_value( std::pmr::memory_resource * resource = std::pmr::get_default_resource() ) const
 		{
-			clear();
+			istream_wrapper< char * > stream( _str, _end - _str );
 
-			_element = val._element;
-			_resource = val._resource;
+			return __read_value( resource, stream );
+		}
 
-			std::visit( overloaded{
-				[this]( array_t * val ) { _element = __copy_array( _resource, val ); },
-				[this]( object_t * val ) { _element = __copy_object( _resource, val ); },
-				[]( auto & ) {}
-				}, _element );
+	private:
+		template< typename E > E read( E && element, jsonhpp::type type ) const
+		{
+			if ( get_type() != type ) JSONHPP_THROW( std::bad_variant_access() );
 
-			return *this;
+			istream_wrapper< char * > stream( _str, _end - _str );
+			element.read( stream );
+
+			return std::move( element );
 		}
 
-		~value()
+		const char * next( const char * str ) const
 		{
-			clear();
+			str += __skip_space( str, _end - str );
+			if ( str == _end ) JSONHPP_THROW( std::out_of_range( "out of range" ) );
+
+			return str;
 		}
 
+	private:
+		const char * _str;
+		const char * _end;
+	};
+
+	class lazy_document : public lazy_value
+	{
 	public:
-		value( bool val )
+		lazy_document( const char * json )
+			:lazy_value( json, json + std::strlen( json ) )
+		{}
+
+		lazy_document( std::string_view json )
+			:lazy_value( json )
+		{}
+	};
+
+	struct __projection
+	{
+		std::string key;
+		bool all = false;
+		std::vector< __projection > children;
+	};
+	inline void __insert_projection( __projection & root, std::string_view path )
+	{
+		__projection * node = &root;
+		const char separator = ( !path.empty() && path[0] == '/' ) ? '/' : '.';
+		if ( separator == '/' ) path.remove_prefix( 1 );
+		else if ( path.empty() ) node->all = true;
+
+		while ( !node->all )
+		{
+			std::string key;
+			std::size_t pos = std::min( path.find( separator ), path.size() );
+			for ( std::size_t i = 0; i < pos; i++ )
+			{
+				if ( separator == '/' && path[i] == '~' && i + 1 < pos && ( path[i + 1] == '0' || path[i + 1] == '1' ) )
+				{
+					key.push_back( path[++i] == '0' ? '~' : '/' );
+				}
+				else
+				{
+					key.push_back( path[i] );
+				}
+			}
+
+			auto it = std::find_if( node->children.begin(), node->children.end(), [&]( const __projection & child ) { return child.key == key; } );
+			if ( it == node->children.end() )
+			{
+				node->children.push_back( { std::move( key ), false, {} } );
+				it = node->children.end() - 1;
+			}
+			node = &*it;
+
+			if ( pos == path.size() ) node->all = true;
+			else path.remove_prefix( pos + 1 );
+		}
+	}
+	inline bool __read_projected( value & result, istream_wrapper< char * > & stream, const __projection & node, std::uint32_t depth, std::uint32_t max_depth )
+	{
+		auto resource = result.resource();
+		auto skip = [&]()
 		{
-			_element = boolean_t( val );
-		}
-
-		value( float val )
+			const char * data = stream.data();
+			stream.skip( __skip_value( data, data + stream.remain() ) - data );
+		};
+		auto separator = [&]( char close )
 		{
-			_element = number_t( val );
-		}
+			__stream_ignore( stream );
+			if ( __stream_check( stream, ',' ) ) return true;
+			if ( __stream_check( stream, close ) ) return false;
 
-		value( double val )
+			JSONHPP_THROW( std::invalid_argument( "not matched \',\'" ) );
+		};
+		auto find = [&]( std::string_view key )
 		{
-			_element = number_t( val );
-		}
+			return std::find_if( node.children.begin(), node.children.end(), [key]( const __projection & child ) { return child.key == key; } );
+		};
 
-		value( std::nullptr_t )
+		__stream_ignore( stream );
+		if ( node.all )
 		{
-			_element = null_t( _resource );
+			result = __read_value( resource, stream, max_depth - depth );
+			return true;
 		}
 
-		value( std::int8_t val )
+		char c = stream.peek();
+		if ( c != '[' && c != '{' )
 		{
-			_element = number_t( val );
+			skip();
+			return false;
 		}
+		if ( depth >= max_depth ) JSONHPP_THROW( std::length_error( "nesting too deep!" ) );
 
-		value( std::int16_t val )
+		stream.get();
+		__stream_ignore( stream );
+		if ( c == '{' )
 		{
-			_element = number_t( val );
-		}
+			object_t * object = new ( resource->allocate( sizeof( object_t ), alignof( object_t ) ) ) object_t( resource );
+			result = value( resource, object );
+			if ( __stream_check( stream, '}' ) ) return true;
 
-		value( std::int32_t val )
-		{
-			_element = number_t( val );
-		}
+			std::pmr::string buf;
+			do
+			{
+				__stream_ignore( stream );
+				if ( stream.peek() != '\"' ) JSONHPP_THROW( std::invalid_argument( "not matched key" ) );
 
-		value( std::int64_t val )
-		{
-			_element = number_t( val );
-		}
+				std::string_view key = __read_string_insitu( stream, buf );
+				if ( key.data() == nullptr ) key = { buf.data(), buf.size() };
 
-		value( std::uint8_t val )
-		{
-			_element = number_t( val );
-		}
+				__stream_ignore( stream );
+				if ( !__stream_check( stream, ':' ) ) JSONHPP_THROW( std::invalid_argument( "not matched \':\'" ) );
+				__stream_ignore( stream );
 
-		value( std::uint16_t val )
-		{
-			_element = number_t( val );
-		}
+				auto it = find( key );
+				if ( it == node.children.end() )
+				{
+					skip();
+					continue;
+				}
 
-		value( std::uint32_t val )
-		{
-			_element = number_t( val );
+				value val( resource );
+				if ( __read_projected( val, stream, *it, depth + 1, max_depth ) ) object->insert( string_t( resource, key ), std::move( val ) );
+			} while ( separator( '}' ) );
 		}
-
-		value( std::uint64_t val )
+		else
 		{
-			_element = number_t( val );
-		}
+			array_t * array = new ( resource->allocate( sizeof( array_t ), alignof( array_t ) ) ) array_t( resource );
+			result = value( resource, array );
+			if ( __stream_check( stream, ']' ) ) return true;
 
-		value( const char * str )
-		{
-			_element = string_t( _resource, str );
+			std::size_t count = 0;
+			for ( const auto & child : node.children )
+			{
+				std::size_t index = 0;
+				auto r = std::from_chars( child.key.data(), child.key.data() + child.key.size(), index );
+				if ( r.ec == std::errc() && r.ptr == child.key.data() + child.key.size() ) count = std::max( count, index + 1 );
+			}
+
+			std::size_t i = 0;
+			do
+			{
+				char buf[24];
+				auto r = std::to_chars( buf, buf + sizeof( buf ), i );
+				auto it = find( { buf, static_cast< std::size_t >( r.ptr - buf ) } );
+
+				value val( resource );
+				__stream_ignore( stream );
+				if ( it == node.children.end() || !__read_projected( val, stream, *it, depth + 1, max_depth ) )
+				{
+					if ( it == node.children.end() ) skip();
+					val.set_null();
+				}
+
+				if ( i++ < count ) array->push_back( std::move( val ) );
+			} while ( separator( ']' ) );
 		}
 
-		value( std::string_view str )
+		return true;
+	}
+
+	inline bool __validate_hex4( const char * str, const char * end, std::uint32_t & code )
+	{
+		if ( end - str < 4 ) return false;
+
+		code = 0;
+		for ( int i = 0; i < 4; i++ )
 		{
-			_element = string_t( _resource, str );
-		}
+			int h = __hex_value( str[i] );
+			if ( h < 0 ) return false;
 
-		value( const std::initializer_list< value > & list )
+			code = ( code << 4 ) | static_cast< std::uint32_t >( h );
+		}
+		return true;
+	}
+	inline jsonhpp::error __validate_string( const char *& str, const char * end )
+	{
+		while ( true )
 		{
-			bool is_obj = false;
-			if ( list.size() % 2 == 0 )
+			std::size_t n = __scan_string( str, end - str );
+			if ( !__is_utf8( str, n ) )
 			{
-				is_obj = true;
-				for ( auto it = list.begin(); it != list.end(); it += 2 )
+				for ( std::size_t i = 1; i != 0; str += i )
 				{
-					if ( !it->is_string() )
+					i = static_cast< unsigned char >( *str ) < 0x80 ? 1 : __validate_utf8( str, end );
+				}
+				return jsonhpp::error::invalid_utf8;
+			}
+
+			str += n;
+			if ( str == end ) return jsonhpp::error::unexpected_end;
+
+			auto c = static_cast< unsigned char >( *str );
+			if ( c == '\"' )
+			{
+				++str;
+				return jsonhpp::error::none;
+			}
+
+			if ( c == '\\' )
+			{
+				if ( end - str < 2 ) return jsonhpp::error::unexpected_end;
+
+				switch ( str[1] )
+				{
+				case '\"': case '\\': case '/': case 'b': case 'f': case 'n': case 'r': case 't':
+					str += 2;
+					break;
+				case 'u':
+				{
+					std::uint32_t code, low;
+					if ( !__validate_hex4( str + 2, end, code ) ) return jsonhpp::error::invalid_escape;
+					if ( code >= 0xDC00 && code <= 0xDFFF ) return jsonhpp::error::invalid_unicode;
+					if ( code >= 0xD800 && code <= 0xDBFF )
 					{
-						is_obj = false;
-						break;
+						if ( end - str < 12 || str[6] != '\\' || str[7] != 'u' || !__validate_hex4( str + 8, end, low ) || low < 0xDC00 || low > 0xDFFF ) return jsonhpp::error::invalid_unicode;
+						str += 6;
 					}
+					str += 6;
+				}
+				break;
+				default:
+					return jsonhpp::error::invalid_escape;
 				}
 			}
-
-			if ( is_obj )
-				_element = __make_object( _resource, list );
 			else
-				_element = __make_array( _resource, list );
+			{
+				return jsonhpp::error::invalid_string;
+			}
 		}
-
-		template< typename A > value( const std::basic_string< char, std::char_traits< char >, A > & str )
+	}
+	inline jsonhpp::error __validate_number( const char *& str, const char * end )
+	{
+		const char * number = str;
+		std::size_t scale = 0;
+		auto digits = [&]()
 		{
-			_element = string_t( _resource, str );
-		}
+			const char * begin = str;
+			while ( str != end && *str >= '0' && *str <= '9' ) ++str;
+			scale += str - begin;
+			return str != begin;
+		};
 
-		value & operator= ( float val )
-		{
-			clear();
-			_element = number_t( val );
-			return *this;
-		}
+		if ( *str == '-' ) ++str;
+		if ( str != end && *str == '0' ) ++str;
+		else if ( !digits() ) return jsonhpp::error::invalid_number;
 
-		value & operator= ( double val )
+		if ( str != end && *str == '.' )
 		{
-			clear();
-			_element = number_t( val );
-			return *this;
+			++str;
+			if ( !digits() ) return jsonhpp::error::invalid_number;
 		}
-
-		value & operator= ( std::nullptr_t )
+		if ( str != end && ( *str == 'e' || *str == 'E' ) )
 		{
-			clear();
-			_element = null_t( _resource );
-			return *this;
-		}
+			++str;
+			if ( str != end && ( *str == '+' || *str == '-' ) ) ++str;
 
-		value & operator= ( std::int8_t val )
-		{
-			clear();
-			_element = number_t( val );
-			return *this;
-		}
+			std::size_t exponent = 0;
+			const char * begin = str;
+			for ( ; str != end && *str >= '0' && *str <= '9'; ++str )
+			{
+				if ( exponent < 0x10000 ) exponent = exponent * 10 + ( *str - '0' );
+			}
+			if ( str == begin ) return jsonhpp::error::invalid_number;
 
-		value & operator= ( std::int16_t val )
-		{
-			clear();
-			_element = number_t( val );
-			return *this;
+			scale += exponent;
 		}
 
-		value & operator= ( std::int32_t val )
-		{
-			clear();
-			_element = number_t( val );
-			return *this;
-		}
+		if ( str != end && !__is_structural_end( *str ) ) return jsonhpp::error::invalid_number;
 
-		value & operator= ( std::int64_t val )
+		// only numbers this far from 1.0 can leave the range of a double, which the reader rejects
+		if ( scale > 280 )
 		{
-			clear();
-			_element = number_t( val );
-			return *this;
+			bool out_of_range = false;
+			std::variant< double, std::int64_t, std::uint64_t > value;
+			if ( __parse_number( number, str, value, &out_of_range ) == nullptr ) return jsonhpp::error::invalid_number;
 		}
 
-		value & operator= ( std::uint8_t val )
+		return jsonhpp::error::none;
+	}
+	inline jsonhpp::result __validate( const char * begin, const char * end, std::uint32_t max_depth = JSONHPP_MAX_DEPTH )
+	{
+		// one bit per open container, spilled to the heap only for limits above the default
+		std::array< std::uint64_t, ( JSONHPP_MAX_DEPTH + 63 ) / 64 > fixed = {};
+		std::vector< std::uint64_t > spill;
+		std::uint64_t * stack = fixed.data();
+		if ( max_depth > JSONHPP_MAX_DEPTH )
 		{
-			clear();
-			_element = number_t( val );
-			return *this;
+			spill.assign( ( static_cast< std::size_t >( max_depth ) + 63 ) / 64, 0 );
+			stack = spill.data();
 		}
+		std::size_t depth = 0;
 
-		value & operator= ( std::uint16_t val )
+		const char * str = begin;
+		auto fail = [&]( jsonhpp::error code )
 		{
-			clear();
-			_element = number_t( val );
-			return *this;
-		}
-
-		value & operator= ( std::uint32_t val )
+			return jsonhpp::result{ code, static_cast< std::size_t >( str - begin ) };
+		};
+		auto next = [&]()
 		{
-			clear();
-			_element = number_t( val );
-			return *this;
-		}
-
-		value & operator= ( std::uint64_t val )
+			str += __skip_space( str, end - str );
+			return str != end;
+		};
+		auto literal = [&]( const char * text, std::size_t size )
 		{
-			clear();
-			_element = number_t( val );
-			return *this;
-		}
+			if ( static_cast< std::size_t >( end - str ) < size || std::memcmp( str, text, size ) != 0 ) return jsonhpp::error::unexpected_character;
 
-		value & operator= ( const char * str )
-		{
-			clear();
-			_element = string_t( _resource, str );
-			return *this;
-		}
+			str += size;
+			return jsonhpp::error::none;
+		};
 
-		value & operator= ( std::string_view str )
+		while ( true )
 		{
-			clear();
-			_element = string_t( _resource, str );
-			return *this;
-		}
+			jsonhpp::error code = jsonhpp::error::none;
+			bool key = false;
 
-		template< typename A > value & operator= ( const std::basic_string< char, std::char_traits< char >, A > & str )
-		{
-			clear();
-			_element = string_t( _resource, str );
-			return *this;
-		}
+			if ( !next() ) return fail( jsonhpp::error::unexpected_end );
+			switch ( *str )
+			{
+			case 'n':
+				code = literal( "null", 4 );
+				break;
+			case 't':
+				code = literal( "true", 4 );
+				break;
+			case 'f':
+				code = literal( "false", 5 );
+				break;
+			case '\"':
+				++str;
+				code = __validate_string( str, end );
+				break;
+			case '-': case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7': case '8': case '9':
+				code = __validate_number( str, end );
+				break;
+			case '[': case '{':
+			{
+				if ( depth >= max_depth ) return fail( jsonhpp::error::depth_exceeded );
 
-		value & operator= ( const std::initializer_list< value > & list )
-		{
-			clear();
+				bool object = ( *str++ == '{' );
+				if ( !next() ) return fail( jsonhpp::error::unexpected_end );
+				if ( *str == ( object ? '}' : ']' ) )
+				{
+					++str;
+					break;
+				}
 
-			bool is_obj = false;
-			if ( list.size() % 2 == 0 )
+				std::uint64_t bit = std::uint64_t( 1 ) << ( depth % 64 );
+				stack[depth / 64] = object ? ( stack[depth / 64] | bit ) : ( stack[depth / 64] & ~bit );
+				++depth;
+
+				if ( !object ) continue;
+				key = true;
+			}
+			break;
+			default:
+				return fail( jsonhpp::error::unexpected_character );
+			}
+			if ( code != jsonhpp::error::none ) return fail( code );
+
+			while ( !key && depth != 0 )
 			{
-				is_obj = true;
-				for ( auto it = list.begin(); it != list.end(); it += 2 )
+				bool object = ( ( stack[( depth - 1 ) / 64] >> ( ( depth - 1 ) % 64 ) ) & 1 ) != 0;
+
+				if ( !next() ) return fail( jsonhpp::error::unexpected_end );
+				if ( *str == ',' )
 				{
-					if ( !it->is_string() )
-					{
-						is_obj = false;
-						break;
-					}
+					++str;
+					if ( !object ) break;
+					key = true;
+				}
+				else if ( *str == ( object ? '}' : ']' ) )
+				{
+					++str;
+					--depth;
+				}
+				else
+				{
+					return fail( jsonhpp::error::unexpected_character );
 				}
 			}
 
-			if ( is_obj )
-				_element = __make_object( _resource, list );
-			else
-				_element = __make_array( _resource, list );
+			if ( key )
+			{
+				if ( !next() ) return fail( jsonhpp::error::unexpected_end );
+				if ( *str != '\"' ) return fail( jsonhpp::error::unexpected_character );
 
-			return *this;
-		}
+				++str;
+				code = __validate_string( str, end );
+				if ( code != jsonhpp::error::none ) return fail( code );
 
-	public:
-		value & operator[]( std::size_t val )
-		{
-			return reinterpret_cast<unknown_t *>( std::get< element< jsonhpp::type::array > * >( _element ) )->find_value( val );
-		}
+				if ( !next() ) return fail( jsonhpp::error::unexpected_end );
+				if ( *str != ':' ) return fail( jsonhpp::error::unexpected_character );
 
-		value & operator[]( std::string_view val )
-		{
-			return reinterpret_cast<unknown_t *>( std::get< element< jsonhpp::type::object > * >( _element ) )->find_value( val );
-		}
+				++str;
+				continue;
+			}
 
-	public:
-		void swap( value & val )
-		{
-			std::swap( _element, val._element );
-			std::swap( _resource, val._resource );
+			if ( depth == 0 ) break;
 		}
 
+		if ( next() ) return fail( jsonhpp::error::trailing_characters );
+
+		return {};
+	}
+
+	inline std::size_t __thread_count( std::size_t threads )
+	{
+		return threads != 0 ? threads : std::max< std::size_t >( std::thread::hardware_concurrency(), 1 );
+	}
+
+	// the calling thread works too, so a pool of n runs n - 1 threads; they are started once and reused
+	// by every read_ndjson / read_parallel call given the pool, calls from several threads take turns
+	class thread_pool
+	{
 	public:
-		type get_type() const
+		explicit thread_pool( std::size_t threads = 0 )
 		{
-			return std::visit( overloaded{
-				[]( const std::monostate & ) { return jsonhpp::type::unknown; },
-				[]( const null_t & val ) { return val.get_type(); },
-				[]( const string_t & val ) { return val.get_type(); },
-				[]( const number_t & val ) { return val.get_type(); },
-				[]( const boolean_t & val ) { return val.get_type(); },
-				[]( const array_t * val ) { return jsonhpp::type::array; },
-				[]( const object_t * val ) { return jsonhpp::type::object; },
-				}, _element );
+			threads = __thread_count( threads );
+			for ( std::size_t i = 1; i < threads; i++ )
+			{
+				_threads.emplace_back( [this]() { work(); } );
+			}
 		}
 
-		std::pmr::memory_resource * resource() const
+		thread_pool( const thread_pool & ) = delete;
+
+		thread_pool & operator= ( const thread_pool & ) = delete;
+
+		~thread_pool()
 		{
-			return _resource;
+			{
+				std::lock_guard< std::mutex > lock( _mutex );
+				_stop = true;
+			}
+			_wake.notify_all();
+
+			for ( auto & thread : _threads )
+			{
+				thread.join();
+			}
 		}
 
 	public:
-		bool empty() const
+		std::size_t size() const
 		{
-			return get_type() == jsonhpp::type::unknown;
+			return _threads.size() + 1;
 		}
 
-		bool is_null() const
+		void run( std::size_t count, const std::function< void( std::size_t ) > & task )
 		{
-			return get_type() == jsonhpp::type::null;
+			std::lock_guard< std::mutex > turn( _turn );
+			{
+				std::lock_guard< std::mutex > lock( _mutex );
+				_task = &task;
+				_next = 0;
+				_count = count;
+				_pending = count;
+				++_generation;
+			}
+			_wake.notify_all();
+
+			execute();
+
+			std::unique_lock< std::mutex > lock( _mutex );
+			_done.wait( lock, [this]() { return _pending == 0; } );
+			_task = nullptr;
 		}
 
-		bool is_array() const
+	private:
+		void work()
 		{
-			return get_type() == jsonhpp::type::array;
+			for ( std::size_t generation = 0; ; )
+			{
+				{
+					std::unique_lock< std::mutex > lock( _mutex );
+					_wake.wait( lock, [&]() { return _stop || _generation != generation; } );
+					if ( _stop ) return;
+
+					generation = _generation;
+				}
+
+				execute();
+			}
 		}
 
-		bool is_string() const
+		void execute()
 		{
-			return get_type() == jsonhpp::type::string;
+			while ( true )
+			{
+				std::size_t index;
+				const std::function< void( std::size_t ) > * task;
+				{
+					std::lock_guard< std::mutex > lock( _mutex );
+					if ( _task == nullptr || _next >= _count ) return;
+
+					index = _next++;
+					task = _task;
+				}
+
+				( *task )( index );
+
+				std::lock_guard< std::mutex > lock( _mutex );
+				if ( --_pending == 0 ) _done.notify_all();
+			}
 		}
 
-		bool is_number() const
+	private:
+		std::mutex _turn;
+		std::mutex _mutex;
+		std::condition_variable _wake;
+		std::condition_variable _done;
+		std::vector< std::thread > _threads;
+		const std::function< void( std::size_t ) > * _task = nullptr;
+		std::size_t _next = 0;
+		std::size_t _count = 0;
+		std::size_t _pending = 0;
+		std::size_t _generation = 0;
+		bool _stop = false;
+	};
+
+	struct __ndjson_chunk
+	{
+		__ndjson_chunk( std::string_view text )
+			:text( text ), arena( std::max< std::size_t >( text.size() * 2, 1024 ) ), documents( &arena )
+		{}
+
+		std::string_view text;
+		std::pmr::monotonic_buffer_resource arena;
+		std::pmr::deque< document > documents;
+		std::exception_ptr error;
+	};
+	inline std::string_view __next_ndjson_chunk( std::string_view & json, std::size_t size )
+	{
+		std::size_t pos = json.size() > size ? json.find( '\n', size ) : std::string_view::npos;
+		pos = ( pos == std::string_view::npos ) ? json.size() : pos + 1;
+
+		std::string_view chunk = json.substr( 0, pos );
+		json.remove_prefix( pos );
+
+		return chunk;
+	}
+	inline void __read_ndjson_chunk( __ndjson_chunk & chunk, std::uint32_t max_depth )
+	{
+#if defined( JSONHPP_EXCEPTIONS )
+		try
+#endif
 		{
-			return get_type() == jsonhpp::type::number;
-		}
+			read_stack stack;
+			for ( std::string_view text = chunk.text; !text.empty(); )
+			{
+				std::size_t pos = std::min( text.find( '\n' ), text.size() );
+
+				istream_wrapper< char * > stream( text.data(), pos );
+				text.remove_prefix( std::min( pos + 1, text.size() ) );
+
+				__stream_ignore( stream );
+				if ( stream.remain() == 0 ) continue;
+
+				// a line is only added once it parsed completely, the callback never sees a partial document
+				value val = __read_value( &chunk.arena, stream, stack, max_depth );
+
+				__stream_ignore( stream );
+				if ( stream.remain() != 0 ) JSONHPP_THROW( std::invalid_argument( "trailing characters!" ) );
 
-		bool is_object() const
-		{
-			return get_type() == jsonhpp::type::object;
+				chunk.documents.emplace_back( std::move( val ) );
+			}
 		}
-
-		bool is_boolean() const
+#if defined( JSONHPP_EXCEPTIONS )
+		catch ( ... )
 		{
-			return get_type() == jsonhpp::type::boolean;
+			chunk.error = std::current_exception();
 		}
+#endif
+	}
 
+	class ndjson_batch
+	{
 	public:
-		null_t & get_null()
-		{
-			return std::get< element< jsonhpp::type::null > >( _element );
-		}
+		ndjson_batch() = default;
 
-		array_t & get_array()
+		ndjson_batch( ndjson_batch && ) = default;
+
+		ndjson_batch & operator= ( ndjson_batch && ) = default;
+
+	public:
+		jsonhpp::document & operator[]( std::size_t val )
 		{
-			return *std::get< element< jsonhpp::type::array > * >( _element );
+			return *_documents[val];
 		}
 
-		string_t & get_string()
+		const jsonhpp::document & operator[]( std::size_t val ) const
 		{
-			return std::get< element< jsonhpp::type::string > >( _element );
+			return *_documents[val];
 		}
 
-		number_t & get_number()
+	public:
+		std::size_t size() const
 		{
-			return std::get< element< jsonhpp::type::number > >( _element );
+			return _documents.size();
 		}
 
-		object_t & get_object()
+		bool empty() const
 		{
-			return *std::get< element< jsonhpp::type::object > * >( _element );
+			return _documents.empty();
 		}
 
-		boolean_t & get_boolean()
+		void clear()
 		{
-			return std::get< element< jsonhpp::type::boolean > >( _element );
+			_documents.clear();
+			_chunks.clear();
 		}
 
 	public:
-		const null_t & get_null() const
+		// starts and joins its threads on every call, which shows on small inputs; pass a thread_pool to reuse them
+		void read( std::string_view json, std::size_t threads = 0, std::uint32_t max_depth = JSONHPP_MAX_DEPTH )
 		{
-			return std::get< element< jsonhpp::type::null > >( _element );
-		}
+			thread_pool pool( std::min( __thread_count( threads ), json.size() / ( 64 * 1024 ) + 1 ) );
 
-		const array_t & get_array() const
-		{
-			return *std::get< element< jsonhpp::type::array > * >( _element );
+			read( json, pool, max_depth );
 		}
 
-		const string_t & get_string() const
+		void read( std::string_view json, thread_pool & pool, std::uint32_t max_depth = JSONHPP_MAX_DEPTH )
 		{
-			return std::get< element< jsonhpp::type::string > >( _element );
-		}
+			clear();
 
-		const number_t & get_number() const
-		{
-			return std::get< element< jsonhpp::type::number > >( _element );
-		}
+			std::size_t size = std::clamp< std::size_t >( json.size() / ( pool.size() * 4 ) + 1, 64 * 1024, 16 * 1024 * 1024 );
+			while ( !json.empty() )
+			{
+				_chunks.push_back( std::make_unique< __ndjson_chunk >( __next_ndjson_chunk( json, size ) ) );
+			}
 
-		const object_t & get_object() const
-		{
-			return *std::get< element< jsonhpp::type::object > * >( _element );
-		}
+			pool.run( _chunks.size(), [&]( std::size_t i ) { __read_ndjson_chunk( *_chunks[i], max_depth ); } );
 
-		const boolean_t & get_boolean() const
-		{
-			return std::get< element< jsonhpp::type::boolean > >( _element );
+			for ( auto & chunk : _chunks )
+			{
+				if ( chunk->error )
+				{
+					std::exception_ptr error = chunk->error;
+
+					clear();
+					std::rethrow_exception( error );
+				}
+
+				for ( auto & doc : chunk->documents )
+				{
+					_documents.push_back( &doc );
+				}
+			}
 		}
 
-	public:
-		void set_null()
+	private:
+		std::vector< std::unique_ptr< __ndjson_chunk > > _chunks;
+		std::vector< jsonhpp::document * > _documents;
+	};
+
+	struct __parallel_range
+	{
+		std::string_view text;
+		std::pmr::memory_resource * resource;
+		std::unique_ptr< std::pmr::memory_resource > arena;
+		std::vector< value > values;
+		std::vector< string_t > keys;
+		std::exception_ptr error;
+	};
+	inline void __read_parallel_range( __parallel_range & range, bool object, std::uint32_t max_depth )
+	{
+#if defined( JSONHPP_EXCEPTIONS )
+		try
+#endif
 		{
-			clear();
-			_element = null_t( _resource );
-		}
+			auto resource = range.resource;
+			istream_wrapper< char * > stream( range.text.data(), range.text.size() );
+			read_stack stack;
 
-		void set_int( std::int64_t val )
+			do
+			{
+				__stream_ignore( stream );
+				if ( object )
+				{
+					if ( stream.peek() != '\"' ) JSONHPP_THROW( std::invalid_argument( "not matched key" ) );
+
+					string_t & key = range.keys.emplace_back( resource );
+					key.read( stream );
+
+					__stream_ignore( stream );
+					if ( !__stream_check( stream, ':' ) ) JSONHPP_THROW( std::invalid_argument( "not matched \':\'" ) );
+				}
+
+				range.values.push_back( __read_value( resource, stream, stack, max_depth ) );
+
+				__stream_ignore( stream );
+			} while ( __stream_check( stream, ',' ) );
+
+			if ( stream.remain() != 0 ) JSONHPP_THROW( std::invalid_argument( "not matched \',\'" ) );
+		}
+#if defined( JSONHPP_EXCEPTIONS )
+		catch ( ... )
 		{
-			clear();
-			_element = number_t( val );
+			range.error = std::current_exception();
 		}
+#endif
+	}
+	inline void __read_parallel( value & result, const char * str, std::size_t size, thread_pool & pool, std::uint32_t max_depth )
+	{
+		std::vector< std::uint32_t > index;
+		__build_index( str, size, index );
 
-		void set_uint( std::uint64_t val )
+		if ( index.empty() ) JSONHPP_THROW( std::invalid_argument( "unexpected end!" ) );
+
+		char open = str[index.front()];
+		if ( ( open != '[' && open != '{' ) || index.size() < 3 || pool.size() < 2 )
 		{
-			clear();
-			_element = number_t( val );
+			__read_indexed( result, str, size, index, max_depth );
+			return;
 		}
+		if ( max_depth == 0 ) JSONHPP_THROW( std::length_error( "nesting too deep!" ) );
 
-		void set_float( double val )
+		std::size_t close = 0;
+		std::vector< std::uint32_t > commas;
+		std::uint32_t depth = 0;
+		for ( std::size_t i = 0; i < index.size(); i++ )
 		{
-			clear();
-			_element = number_t( val );
+			char c = str[index[i]];
+			if ( c == '[' || c == '{' )
+			{
+				++depth;
+			}
+			else if ( c == ']' || c == '}' )
+			{
+				if ( depth == 0 ) JSONHPP_THROW( std::invalid_argument( "unknown character" ) );
+				if ( --depth == 0 )
+				{
+					close = index[i];
+					if ( i + 1 != index.size() ) JSONHPP_THROW( std::invalid_argument( "unknown character" ) );
+				}
+			}
+			else if ( c == ',' && depth == 1 )
+			{
+				commas.push_back( index[i] );
+			}
 		}
+		if ( depth != 0 ) JSONHPP_THROW( std::invalid_argument( "unexpected end!" ) );
+		if ( str[close] != ( open == '[' ? ']' : '}' ) ) JSONHPP_THROW( std::invalid_argument( "not matched \',\'" ) );
 
-		void set_string( const char * str )
+		bool object = ( open == '{' );
+		auto resource = result.resource();
+		std::size_t begin = index.front() + 1;
+
+		const char * body = str + begin;
+		std::size_t length = close - begin;
+		while ( length > 0 && __is_space( body[length - 1] ) ) --length;
+		while ( length > 0 && __is_space( *body ) )
 		{
-			clear();
-			_element = string_t( _resource, str );
+			++body;
+			--length;
 		}
 
-		void set_string( std::string_view str )
+		if ( length == 0 )
 		{
-			clear();
-			_element = string_t( _resource, str );
+			if ( object ) result = value( resource, new ( resource->allocate( sizeof( object_t ), alignof( object_t ) ) ) object_t( resource ) );
+			else result = value( resource, new ( resource->allocate( sizeof( array_t ), alignof( array_t ) ) ) array_t( resource ) );
+			return;
 		}
 
-		template< typename A > void set_string( const std::basic_string< char, std::char_traits< char >, A > & str )
+		// cut at top-level commas so that every range holds a whole number of elements
+		std::vector< __parallel_range > ranges;
+		std::size_t count = std::min( { pool.size() * 4, commas.size() + 1, size / ( 64 * 1024 ) + 1 } );
+		std::size_t step = ( close - begin ) / count + 1;
+		std::size_t from = begin;
+		for ( auto it = commas.begin(); it != commas.end(); )
 		{
-			clear();
-			_element = string_t( _resource, str );
+			it = std::lower_bound( it, commas.end(), static_cast< std::uint32_t >( std::min( from + step, close ) ) );
+			if ( it == commas.end() ) break;
+
+			ranges.push_back( { std::string_view( str + from, *it - from ), resource, nullptr, {}, {}, nullptr } );
+			from = *it++ + 1;
 		}
+		ranges.push_back( { std::string_view( str + from, close - from ), resource, nullptr, {}, {}, nullptr } );
 
-		void set_array( std::initializer_list< value > list )
+		// only new_delete_resource is known to be thread-safe, other resources get a private arena per range
+		if ( resource != std::pmr::new_delete_resource() )
 		{
-			clear();
-			_element = __make_array( _resource, list );
+			for ( auto & range : ranges )
+			{
+				range.arena = std::make_unique< std::pmr::monotonic_buffer_resource >( std::max< std::size_t >( range.text.size() * 2, 1024 ) );
+				range.resource = range.arena.get();
+			}
 		}
 
-		void set_object( std::initializer_list< value > list )
+		pool.run( ranges.size(), [&]( std::size_t i ) { __read_parallel_range( ranges[i], object, max_depth - 1 ); } );
+
+		std::size_t total = 0;
+		for ( auto & range : ranges )
 		{
-			clear();
-			_element = __make_object( _resource, list );
+			if ( range.error ) std::rethrow_exception( range.error );
+
+			total += range.values.size();
 		}
 
-	public:
-		void clear()
+		// elements already in resource are moved, those in a private arena are copied out before it goes away
+		if ( object )
 		{
-			std::visit( overloaded{
-				[this]( array_t * val ) 
-				{
-					auto p = reinterpret_cast<unknown_t *>( val );
-					auto size = p->get_size();
+			object_t * container = new ( resource->allocate( sizeof( object_t ), alignof( object_t ) ) ) object_t( resource );
+			result = value( resource, container );
+			container->reserve( total );
 
-					p->~unknown_t();
-					_resource->deallocate( p, size );
-				},
-				[this]( object_t * val )
+			for ( auto & range : ranges )
+			{
+				for ( std::size_t i = 0; i < range.values.size(); i++ )
 				{
-					auto p = reinterpret_cast<unknown_t *>( val );
-					auto size = p->get_size();
-
-					p->~unknown_t();
-					_resource->deallocate( p, size ); 
-				},
-				[this]( auto & ) {}
-				}, _element );
-
-			_element = {};
+					if ( range.arena ) container->insert( string_t( resource, std::string_view( range.keys[i] ) ), std::move( range.values[i] ) );
+					else container->insert( std::move( range.keys[i] ), std::move( range.values[i] ) );
+				}
+			}
 		}
+		else
+		{
+			array_t * container = new ( resource->allocate( sizeof( array_t ), alignof( array_t ) ) ) array_t( resource );
+			result = value( resource, container );
+			container->reserve( total );
 
-	protected:
-		element_type _element;
-		std::pmr::memory_resource * _resource = std::pmr::get_default_resource();
-	};
+			for ( auto & range : ranges )
+			{
+				for ( auto & val : range.values )
+				{
+					container->push_back( std::move( val ) );
+				}
+			}
+		}
+	}
 
-	template<> class element< jsonhpp::type::array > : public element< jsonhpp::type::unknown >
+	class push_parser
 	{
 	public:
-		static constexpr jsonhpp::type value_t = jsonhpp::type::array;
-
-	public:
-		using size_type = std::size_t;
-		using value_type = jsonhpp::value;
-		using container_type = std::pmr::vector< value_type >;
-		using iterator = typename container_type::iterator;
-		using const_iterator = typename container_type::const_iterator;
-
-	public:
-		element() = default;
-
-		element( std::pmr::memory_resource * resource )
+		push_parser( jsonhpp::document & doc, std::uint32_t max_depth = JSONHPP_MAX_DEPTH )
+			:_doc( doc ), _result( doc.resource() ), _max_depth( max_depth )
 		{}
 
-		~element() override = default;
+		push_parser( const push_parser & ) = delete;
 
-	protected:
-		std::size_t get_size() const override
-		{
-			return sizeof( *this );
-		}
+		push_parser & operator= ( const push_parser & ) = delete;
 
-		value & find_value( std::size_t val ) override
+	public:
+		bool feed( std::string_view data )
 		{
-			return _value[val];
+			return feed( data.data(), data.size() );
 		}
 
-		value & find_value( std::string_view val ) override
+		bool feed( const char * data, std::size_t size )
 		{
-			throw std::bad_variant_access();
-		}
+			const char * str = data;
+			const char * end = data + size;
 
-	public:
-		jsonhpp::type get_type() const
-		{
-			return value_t;
-		}
+			if ( _token != '\0' && !resume( str, end ) ) return false;
 
-	public:
-		value_type & operator[]( size_type val )
-		{
-			return _value[val];
+			while ( str < end )
+			{
+				while ( str < end && __is_space( *str ) ) ++str;
+				if ( str == end ) break;
+
+				switch ( _state )
+				{
+				case state::done:
+					JSONHPP_THROW( std::invalid_argument( "trailing characters!" ) );
+				case state::first_value:
+					if ( *str == ']' )
+					{
+						++str;
+						close();
+						break;
+					}
+					[[fallthrough]];
+				case state::value:
+					if ( !begin( str, end ) ) return false;
+					break;
+				case state::first_key:
+					if ( *str == '}' )
+					{
+						++str;
+						close();
+						break;
+					}
+					[[fallthrough]];
+				case state::key:
+					if ( *str != '\"' ) JSONHPP_THROW( std::invalid_argument( "not matched key" ) );
+					if ( !token( '\"', str, end ) ) return false;
+					break;
+				case state::colon:
+					if ( *str++ != ':' ) JSONHPP_THROW( std::invalid_argument( "not matched \':\'" ) );
+					_state = state::value;
+					break;
+				case state::separator:
+				{
+					char c = *str++;
+					frame & top = _stack.back();
+					if ( c == ',' )
+					{
+						_state = top.array != nullptr ? state::value : state::key;
+					}
+					else if ( ( c == ']' && top.array != nullptr ) || ( c == '}' && top.object != nullptr ) )
+					{
+						close();
+					}
+					else
+					{
+						JSONHPP_THROW( std::invalid_argument( "not matched \',\'" ) );
+					}
+				}
+				break;
+				}
+			}
+
+			return done();
 		}
 
-		const value_type & operator[]( size_type val ) const
+		void finish()
 		{
-			return _value[val];
+			if ( _token != '\0' )
+			{
+				if ( _token == '\"' ) JSONHPP_THROW( std::invalid_argument( "unexpected end!" ) );
+
+				complete( _buffer.data(), _buffer.size() );
+			}
+
+			if ( !done() ) JSONHPP_THROW( std::invalid_argument( "unexpected end!" ) );
 		}
 
-	public:
-		size_type size() const
+		bool done() const
 		{
-			return _value.size();
+			return _state == state::done;
 		}
 
-		iterator earse( const_iterator val )
+		void reset()
 		{
-			return _value.erase( val );
+			_stack.clear();
+			_result = value( _doc.resource() );
+			_target = nullptr;
+			_state = state::value;
+			_token = '\0';
+			_escaped = false;
+			_buffer.clear();
 		}
 
-		void push_back( const value_type & val )
+	private:
+		enum class state
 		{
-			_value.push_back( val );
-		}
+			value,
+			first_value,
+			key,
+			first_key,
+			colon,
+			separator,
+			done,
+		};
 
-	public:
-		iterator begin()
+		struct frame
 		{
-			return _value.begin();
-		}
+			array_t * array;
+			object_t * object;
+		};
 
-		iterator end()
+	private:
+		bool begin( const char * & str, const char * end )
 		{
-			return _value.end();
+			auto resource = _doc.resource();
+
+			if ( _stack.empty() )
+			{
+				_target = &_result;
+			}
+			else if ( _stack.back().array != nullptr )
+			{
+				array_t * array = _stack.back().array;
+				array->push_back( value( resource ) );
+				_target = &( *array )[array->size() - 1];
+			}
+
+			switch ( *str )
+			{
+			case '[':
+			case '{':
+			{
+				if ( _stack.size() >= _max_depth ) JSONHPP_THROW( std::length_error( "nesting too deep!" ) );
+
+				if ( *str == '[' )
+				{
+					array_t * array = new ( resource->allocate( sizeof( array_t ), alignof( array_t ) ) ) array_t( resource );
+					*_target = value( resource, array );
+					_stack.push_back( { array, nullptr } );
+					_state = state::first_value;
+				}
+				else
+				{
+					object_t * object = new ( resource->allocate( sizeof( object_t ), alignof( object_t ) ) ) object_t( resource );
+					*_target = value( resource, object );
+					_stack.push_back( { nullptr, object } );
+					_state = state::first_key;
+				}
+
+				++str;
+				return true;
+			}
+			case '\"':
+				return token( '\"', str, end );
+			case '-': case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7': case '8': case '9':
+				return token( '0', str, end );
+			case 'n': case 't': case 'f':
+				return token( 'a', str, end );
+			default:
+				JSONHPP_THROW( std::invalid_argument( "unknown character" ) );
+			}
 		}
 
-		const_iterator begin() const
+		bool token( char kind, const char * & str, const char * end )
 		{
-			return _value.begin();
+			const char * start = str;
+
+			_token = kind;
+			_escaped = false;
+			if ( kind == '\"' ) ++str;
+
+			if ( !scan( str, end ) )
+			{
+				_buffer.assign( start, end );
+				str = end;
+				return false;
+			}
+
+			complete( start, str - start );
+			return true;
 		}
 
-		const_iterator end() const
+		bool resume( const char * & str, const char * end )
 		{
-			return _value.end();
+			const char * start = str;
+			bool found = scan( str, end );
+
+			_buffer.append( start, str );
+			if ( !found ) return false;
+
+			complete( _buffer.data(), _buffer.size() );
+			return true;
 		}
 
-	public:
-		template< typename T > void read( istream_wrapper< T > & stream )
+		bool scan( const char * & str, const char * end )
 		{
-			if ( !__stream_check( stream, '[' ) ) throw std::invalid_argument( "not matched \'[\'" );
+			if ( _token == '\"' )
 			{
-				while ( __stream_peek( stream ) != ']' )
+				while ( str < end )
 				{
-					__stream_ignore( stream );
+					if ( _escaped )
 					{
-						_value.push_back( __read_value( _value.get_allocator().resource(), stream ) );
+						_escaped = false;
+						++str;
+						continue;
 					}
-					__stream_ignore( stream );
 
-					__stream_check( stream, ',' );
+					str += __scan_string( str, end - str );
+					if ( str == end ) break;
+
+					char c = *str++;
+					if ( c == '\\' ) _escaped = true;
+					else if ( c == '\"' ) return true;
 				}
+
+				return false;
 			}
-			if ( !__stream_check( stream, ']' ) ) throw std::invalid_argument( "not matched \']\'" );
-		}
 
-		template< typename T > void write( ostream_wrapper< T > & stream, std::uint32_t depth, std::uint32_t tab = 0 ) const
-		{
-			__stream_puts( stream, "[" );
-			for ( size_t i = 0; i < _value.size(); i++ )
+			bool number = ( _token == '0' );
+			auto member = [number]( char c )
 			{
-				if ( tab != 0 ) __stream_put( stream, '\n' );
-				__stream_put_tab( stream, depth + 1, tab );
-
-				__write_value( _value[i], stream, depth + 1, tab );
+				if ( number ) return ( c >= '0' && c <= '9' ) || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E';
 
-				if ( i + 1 < _value.size() )
-				{
-					__stream_put( stream, ',' );
-				}
-			}
+				return c >= 'a' && c <= 'z';
+			};
+			while ( str < end && member( *str ) ) ++str;
 
-			if ( tab != 0 ) __stream_put( stream, '\n' );
-			__stream_put_tab( stream, depth, tab );
-			__stream_puts( stream, "]" );
+			return str < end;
 		}
 
-	private:
-		container_type _value;
-	};
-	template<> class element< jsonhpp::type::object > : public element< jsonhpp::type::unknown >
-	{
-	public:
-		static constexpr jsonhpp::type value_t = jsonhpp::type::object;
+		void complete( const char * str, std::size_t size )
+		{
+			auto resource = _doc.resource();
+			istream_wrapper< char * > stream( str, size );
 
-	public:
-		using size_type = std::size_t;
-		using value_type = jsonhpp::value;
-		using container_type = std::pmr::vector< std::pair< std::pmr::string, value_type > >;
-		using iterator = typename container_type::iterator;
-		using const_iterator = typename container_type::const_iterator;
+			auto make = [&]( auto && element )
+			{
+				element.read( stream );
+				if ( stream.remain() != 0 ) JSONHPP_THROW( std::invalid_argument( "unknown character" ) );
 
-	public:
-		element() = default;
+				return value( resource, std::move( element ) );
+			};
+
+			char kind = _token;
+			_token = '\0';
 
-		element( std::pmr::memory_resource * resource )
-		{}
+			if ( kind == '\"' && ( _state == state::key || _state == state::first_key ) )
+			{
+				string_t key( resource );
+				key.read( stream );
 
-		~element() override = default;
+				object_t * object = _stack.back().object;
+				object->insert( std::move( key ), value( resource ) );
+				_target = &( object->end() - 1 )->second;
+				_state = state::colon;
+			}
+			else
+			{
+				if ( kind == '\"' ) *_target = make( string_t( resource ) );
+				else if ( kind == '0' ) *_target = make( number_t( resource ) );
+				else if ( str[0] == 'n' ) *_target = make( null_t( resource ) );
+				else *_target = make( boolean_t( resource ) );
 
-	protected:
-		std::size_t get_size() const override
-		{
-			return sizeof( *this );
-		}
+				_state = _stack.empty() ? state::done : state::separator;
+				if ( done() ) _doc = std::move( _result );
+			}
 
-		value & find_value( std::size_t val ) override
-		{
-			throw std::bad_variant_access();
+			_buffer.clear();
 		}
 
-		value & find_value( std::string_view val ) override
+		void close()
 		{
-			return std::find_if( _value.begin(), _value.end(), [val]( auto & _val ) { return _val.first == val; } )->second;
-		}
+			_stack.pop_back();
 
-	public:
-		jsonhpp::type get_type() const
-		{
-			return value_t;
+			_state = _stack.empty() ? state::done : state::separator;
+			if ( done() ) _doc = std::move( _result );
 		}
 
+	private:
+		jsonhpp::document & _doc;
+		value _result;
+		value * _target = nullptr;
+		std::vector< frame > _stack;
+		std::uint32_t _max_depth;
+		state _state = state::value;
+		char _token = '\0';
+		bool _escaped = false;
+		std::string _buffer;
+	};
+
+	class __mapped_file
+	{
 	public:
-		value_type & operator[] ( std::string_view key )
+		__mapped_file( const std::filesystem::path & path )
 		{
-			auto it = std::find_if( _value.begin(), _value.end(), [&]( const auto & val ) { return val.first == key; } );
-			if ( it != _value.end() )
+#if defined( JSONHPP_MMAP )
+			int fd = ::open( path.c_str(), O_RDONLY );
+			if ( fd < 0 ) JSONHPP_THROW( std::system_error( errno, std::generic_category(), "unable to open file!" ) );
+
+			struct stat st;
+			if ( ::fstat( fd, &st ) != 0 )
 			{
-				return it->second;
+				int code = errno;
+				::close( fd );
+				JSONHPP_THROW( std::system_error( code, std::generic_category(), "unable to stat file!" ) );
 			}
 
-			_value.push_back( { std::pmr::string{ key.data(), key.size(), _value.get_allocator() }, value_type( _value.get_allocator().resource() ) } );
+			_size = static_cast< std::size_t >( st.st_size );
+			if ( _size != 0 )
+			{
+				void * data = ::mmap( nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0 );
+				int code = errno;
+				::close( fd );
 
-			return _value.back().second;
-		}
+				if ( data == MAP_FAILED ) JSONHPP_THROW( std::system_error( code, std::generic_category(), "unable to map file!" ) );
 
-		const value_type & operator[] ( std::string_view key ) const
-		{
-			auto it = std::find_if( _value.begin(), _value.end(), [&]( const auto & val ) { return val.first == key; } );
-			if ( it != _value.end() )
+				::madvise( data, _size, MADV_SEQUENTIAL );
+				_data = static_cast< const char * >( data );
+			}
+			else
 			{
-				return it->second;
+				::close( fd );
 			}
+#else
+			std::ifstream stream( path, std::ios::binary );
+			if ( !stream ) JSONHPP_THROW( std::system_error( std::make_error_code( std::errc::no_such_file_or_directory ), "unable to open file!" ) );
 
-			_value.push_back( { std::pmr::string{ key.data(), key.size(), _value.get_allocator() }, value_type( _value.get_allocator().resource() ) } );
+			_buffer.resize( static_cast< std::size_t >( std::filesystem::file_size( path ) ) );
+			stream.read( _buffer.data(), static_cast< std::streamsize >( _buffer.size() ) );
+			_buffer.resize( static_cast< std::size_t >( stream.gcount() ) );
 
-			return _value.back().second;
+			_data = _buffer.data();
+			_size = _buffer.size();
+#endif
 		}
 
-	public:
-		size_type size() const
-		{
-			return _value.size();
-		}
+		__mapped_file( const __mapped_file & ) = delete;
 
-		iterator earse( const_iterator val )
-		{
-			return _value.erase( val );
-		}
+		__mapped_file & operator= ( const __mapped_file & ) = delete;
 
-		void insert( std::string_view key, const value_type & val )
+		~__mapped_file()
 		{
-			_value.push_back( { { key.data(), key.size(), _value.get_allocator() }, val } );
+#if defined( JSONHPP_MMAP )
+			if ( _data != nullptr ) ::munmap( const_cast< char * >( _data ), _size );
+#endif
 		}
 
 	public:
-		iterator begin()
+		const char * data() const
 		{
-			return _value.begin();
+			return _data;
 		}
 
-		iterator end()
+		std::size_t size() const
 		{
-			return _value.end();
+			return _size;
 		}
 
-		const_iterator begin() const
-		{
-			return _value.begin();
-		}
+	private:
+		const char * _data = nullptr;
+		std::size_t _size = 0;
+#if !defined( JSONHPP_MMAP )
+		std::string _buffer;
+#endif
+	};
 
-		const_iterator end() const
-		{
-			return _value.end();
-		}
+	template< typename T > static void read( jsonhpp::document & doc, jsonhpp::istream_wrapper< T > & stream, std::uint32_t max_depth = JSONHPP_MAX_DEPTH )
+	{
+		doc = __read_value( doc.resource(), stream, max_depth );
+	}
 
-	public:
-		template< typename T > void read( istream_wrapper< T > & stream )
-		{
-			if ( !__stream_check( stream, '{' ) ) throw std::invalid_argument( "not matched \'{\'" );
-			{
-				while ( __stream_peek( stream ) != '}' )
-				{
-					std::pmr::string key( _value.get_allocator() );
-					value_type val( _value.get_allocator().resource() );
+	template< typename T > static void read( jsonhpp::document & doc, jsonhpp::istream_wrapper< T > & stream, jsonhpp::read_stack & stack, std::uint32_t max_depth = JSONHPP_MAX_DEPTH )
+	{
+		doc = __read_value( doc.resource(), stream, stack, max_depth );
+	}
 
-					__stream_ignore( stream );
+	// object keys are interned into pool, which must outlive doc
+	template< typename T > static void read( jsonhpp::document & doc, jsonhpp::istream_wrapper< T > & stream, jsonhpp::key_pool & pool, std::uint32_t max_depth = JSONHPP_MAX_DEPTH )
+	{
+		doc = __read_value( doc.resource(), stream, max_depth, &pool );
+	}
 
-					if ( !__stream_check( stream, '\"' ) ) throw std::invalid_argument( "not matched key" );
-					{
-						while ( __stream_peek( stream ) != '\"' )
-						{
-							key.push_back( __stream_get( stream ) );
-						}
-					}
-					if ( !__stream_check( stream, '\"' ) ) throw std::invalid_argument( "not matched key" );
+	template< typename T > static void write( const jsonhpp::document & doc, jsonhpp::ostream_wrapper< T > & stream, std::uint32_t tab = 0, bool ascii = false )
+	{
+		__write_value( doc, stream, 0, tab, ascii );
+	}
 
-					__stream_ignore( stream );
-					if ( !__stream_check( stream, ':' ) ) throw std::invalid_argument( "not matched \':\'" );
 
-					__stream_ignore( stream );
-					{
-						val = __read_value( _value.get_allocator().resource(), stream ); 
-					}
-					__stream_ignore( stream );
+	static void read( jsonhpp::document & doc, const char * json, std::uint32_t max_depth = JSONHPP_MAX_DEPTH )
+	{
+		jsonhpp::istream_wrapper< char * > wrapper( json, std::strlen( json ) );
 
-					__stream_check( stream, ',' );
+		read( doc, wrapper, max_depth );
+	}
 
-					_value.push_back( { std::move( key ), std::move( val ) } );
-				}
-			}
-			if ( !__stream_check( stream, '}' ) ) throw std::invalid_argument( "not matched \'}\'" );
-		}
+	static void read( jsonhpp::document & doc, std::string_view json, std::uint32_t max_depth = JSONHPP_MAX_DEPTH )
+	{
+		jsonhpp::istream_wrapper< char * > wrapper( json.data(), json.size() );
 
-		template< typename T > void write( ostream_wrapper< T > & stream, std::uint32_t depth, std::uint32_t tab = 0 ) const
-		{
-			__stream_puts( stream, "{" );
-			for ( size_t i = 0; i < _value.size(); i++ )
-			{
-				if ( tab != 0 ) __stream_put( stream, '\n' );
-				__stream_put_tab( stream, depth + 1, tab );
+		read( doc, wrapper, max_depth );
+	}
 
-				__stream_put( stream, '\"' );
-				__stream_puts( stream, _value[i].first.c_str() );
-				__stream_put( stream, '\"' );
+	static void read( jsonhpp::document & doc, std::string_view json, jsonhpp::read_stack & stack, std::uint32_t max_depth = JSONHPP_MAX_DEPTH )
+	{
+		jsonhpp::istream_wrapper< char * > wrapper( json.data(), json.size() );
 
-				if ( tab != 0 ) __stream_put( stream, ' ' );
-				__stream_put( stream, ':' );
-				if ( tab != 0 ) __stream_put( stream, ' ' );
+		read( doc, wrapper, stack, max_depth );
+	}
 
-				__write_value( _value[i].second, stream, depth + 1, tab );
+	static void read( jsonhpp::document & doc, std::string_view json, jsonhpp::key_pool & pool, std::uint32_t max_depth = JSONHPP_MAX_DEPTH )
+	{
+		jsonhpp::istream_wrapper< char * > wrapper( json.data(), json.size() );
 
-				if ( i + 1 < _value.size() )
-				{
-					__stream_put( stream, ',' );
-				}
-			}
+		read( doc, wrapper, pool, max_depth );
+	}
 
-			if ( tab != 0 ) __stream_put( stream, '\n' );
-			__stream_put_tab( stream, depth, tab );
-			__stream_puts( stream, "}" );
-		}
+	static void read_insitu( jsonhpp::document & doc, std::string_view json, std::uint32_t max_depth = JSONHPP_MAX_DEPTH )
+	{
+		jsonhpp::istream_wrapper< char * > wrapper( json.data(), json.size(), true );
 
-	private:
-		mutable container_type _value;
-	};
+		read( doc, wrapper, max_depth );
+	}
 
-	class document : public value
+	static void read_insitu( jsonhpp::document & doc, char * json, std::size_t size, std::uint32_t max_depth = JSONHPP_MAX_DEPTH )
 	{
-	public:
-		using value::value;
-		using value::value::operator=;
+		jsonhpp::istream_wrapper< char * > wrapper( json, size, true );
 
-		document( document && ) = delete;
-		document( const document & ) = delete;
-		document & operator= ( document && ) = delete;
-		document & operator= ( const document & ) = delete;
+		read( doc, wrapper, max_depth );
+	}
 
-		document( std::pmr::memory_resource * resource = std::pmr::get_default_resource() )
-			:value( resource )
-		{}
+	static void read_indexed( jsonhpp::document & doc, std::string_view json, std::uint32_t max_depth = JSONHPP_MAX_DEPTH )
+	{
+		std::vector< std::uint32_t > index;
+		__build_index( json.data(), json.size(), index );
 
-		document( jsonhpp::value && val )
-			:value( std::move( val ) )
-		{}
+		value result( doc.resource() );
+		__read_indexed( result, json.data(), json.size(), index, max_depth );
 
-		document( const jsonhpp::value & val )
-			:value( val )
-		{}
-	};
+		doc = std::move( result );
+	}
 
-	template< typename T > value __read_value( std::pmr::memory_resource * resource, istream_wrapper< T > & stream )
+	template< typename R > static void read_projected( jsonhpp::document & doc, std::string_view json, const R & paths, std::uint32_t max_depth = JSONHPP_MAX_DEPTH )
 	{
-		value::element_type element;
+		__projection root;
+		for ( const auto & path : paths )
+		{
+			__insert_projection( root, path );
+		}
 
-		__stream_ignore( stream );
+		jsonhpp::istream_wrapper< char * > wrapper( json.data(), json.size() );
 
-		switch ( __stream_peek( stream ) )
-		{
-		case 'n':
+		value result( doc.resource() );
+		if ( !__read_projected( result, wrapper, root, 0, max_depth ) ) result.set_null();
+
+		doc = std::move( result );
+	}
+
+	static void read_projected( jsonhpp::document & doc, std::string_view json, std::initializer_list< std::string_view > paths, std::uint32_t max_depth = JSONHPP_MAX_DEPTH )
+	{
+		read_projected< std::initializer_list< std::string_view > >( doc, json, paths, max_depth );
+	}
+
+	static jsonhpp::result validate( std::string_view json, std::uint32_t max_depth = JSONHPP_MAX_DEPTH )
+	{
+		return __validate( json.data(), json.data() + json.size(), max_depth );
+	}
+
+	// validates first, so it accepts only what validate() accepts: unlike read, trailing characters
+	// and invalid UTF-8 are rejected even without JSONHPP_VALIDATE_UTF8, and valid input is scanned twice;
+	// doc is left untouched on failure, and anything thrown past validation comes back as error::unknown
+	static jsonhpp::result try_read( jsonhpp::document & doc, jsonhpp::istream_wrapper< char * > & stream, std::uint32_t max_depth = JSONHPP_MAX_DEPTH ) noexcept
+	{
+#if defined( JSONHPP_EXCEPTIONS )
+		try
+#endif
 		{
-			null_t result( resource );
-			result.read( stream );
-			element = result;
+			jsonhpp::result result = __validate( stream.data(), stream.data() + stream.remain(), max_depth );
+			if ( !result ) return result;
+
+			doc = __read_value( doc.resource(), stream, max_depth );
 		}
-		break;
-		case '[':
+#if defined( JSONHPP_EXCEPTIONS )
+		catch ( const std::bad_alloc & )
 		{
-			array_t * result = new ( resource->allocate( sizeof( array_t ) ) ) array_t( resource );
-			result->read( stream );
-			element = result;
+			return { jsonhpp::error::out_of_memory, 0 };
 		}
-		break;
-		case '\"':
+		catch ( ... )
 		{
-			string_t result( resource );
-			result.read( stream );
-			element = result;
+			return { jsonhpp::error::unknown, 0 };
 		}
-		break;
-		case '-': case '.': case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7': case '8': case '9':
+#endif
+
+		return {};
+	}
+
+	static jsonhpp::result try_read( jsonhpp::document & doc, std::string_view json, std::uint32_t max_depth = JSONHPP_MAX_DEPTH ) noexcept
+	{
+		jsonhpp::istream_wrapper< char * > wrapper( json.data(), json.size() );
+
+		return try_read( doc, wrapper, max_depth );
+	}
+
+	static jsonhpp::result try_read( jsonhpp::document & doc, const char * json, std::uint32_t max_depth = JSONHPP_MAX_DEPTH ) noexcept
+	{
+		jsonhpp::istream_wrapper< char * > wrapper( json, std::strlen( json ) );
+
+		return try_read( doc, wrapper, max_depth );
+	}
+
+	static jsonhpp::result try_write( const jsonhpp::document & doc, char * data, std::size_t size, std::size_t & written, std::uint32_t tab = 0, bool ascii = false ) noexcept
+	{
+		jsonhpp::ostream_wrapper< char * > wrapper( data, size );
+
+#if defined( JSONHPP_EXCEPTIONS )
+		try
+#endif
 		{
-			number_t result( resource );
-			result.read( stream );
-			element = result;
+			__write_value( doc, wrapper, 0, tab, ascii );
 		}
-		break;
-		case '{':
+#if defined( JSONHPP_EXCEPTIONS )
+		catch ( const std::bad_alloc & )
 		{
-			object_t * result = new ( resource->allocate( sizeof( object_t ) ) ) object_t( resource );
-			result->read( stream );
-			element = result;
+			written = wrapper.size();
+			return { jsonhpp::error::out_of_memory, wrapper.size() };
 		}
-		break;
-		case 'f': case 't':
+		catch ( ... )
 		{
-			boolean_t result( resource );
-			result.read( stream );
-			element = result;
-		}
-		break;
-		default:
-			throw std::invalid_argument( "unknown character" );
-			break;
+			written = wrapper.size();
+			return { jsonhpp::error::unknown, wrapper.size() };
 		}
+#endif
+
+		written = wrapper.size();
+		if ( !wrapper.status() ) return wrapper.status();
+		if ( wrapper.overflow() ) return { jsonhpp::error::buffer_too_small, size };
+
+		return {};
+	}
+
+	static void read_parallel( jsonhpp::document & doc, std::string_view json, jsonhpp::thread_pool & pool, std::uint32_t max_depth = JSONHPP_MAX_DEPTH )
+	{
+		value result( doc.resource() );
+		__read_parallel( result, json.data(), json.size(), pool, max_depth );
 
-		return { resource, element };
+		doc = std::move( result );
 	}
-	template< typename T > void __write_value( const value & val, ostream_wrapper< T > & stream, std::uint32_t depth, std::uint32_t tab )
+
+	// starts and joins its threads on every call; pass a thread_pool to reuse them
+	static void read_parallel( jsonhpp::document & doc, std::string_view json, std::size_t threads = 0, std::uint32_t max_depth = JSONHPP_MAX_DEPTH )
 	{
-		switch ( val.get_type() )
-		{
-		case jsonhpp::type::null:
-			val.get_null().write( stream, depth, tab );
-			break;
-		case jsonhpp::type::array:
-			val.get_array().write( stream, depth, tab );
-			break;
-		case jsonhpp::type::string:
-			val.get_string().write( stream, depth, tab );
-			break;
-		case jsonhpp::type::number:
-			val.get_number().write( stream, depth, tab );
-			break;
-		case jsonhpp::type::object:
-			val.get_object().write( stream, depth, tab );
-			break;
-		case jsonhpp::type::boolean:
-			val.get_boolean().write( stream, depth, tab );
-			break;
-		}
+		jsonhpp::thread_pool pool( std::min( __thread_count( threads ), json.size() / ( 64 * 1024 ) + 1 ) );
+
+		read_parallel( doc, json, pool, max_depth );
 	}
-	jsonhpp::element< jsonhpp::type::array > * __make_array( std::pmr::memory_resource * resource, const std::initializer_list< value > & list )
+
+	static void read_ndjson( jsonhpp::ndjson_batch & batch, std::string_view json, jsonhpp::thread_pool & pool, std::uint32_t max_depth = JSONHPP_MAX_DEPTH )
 	{
-		auto result = new ( resource->allocate( sizeof( array_t ) ) ) array_t( resource );
-		for ( const auto & it : list )
+		batch.read( json, pool, max_depth );
+	}
+
+	static void read_ndjson( jsonhpp::ndjson_batch & batch, std::string_view json, std::size_t threads = 0, std::uint32_t max_depth = JSONHPP_MAX_DEPTH )
+	{
+		batch.read( json, threads, max_depth );
+	}
+
+	template< typename F > static void read_ndjson( std::string_view json, F && callback, jsonhpp::thread_pool & pool, std::uint32_t max_depth = JSONHPP_MAX_DEPTH )
+	{
+		std::size_t size = std::clamp< std::size_t >( json.size() / ( pool.size() * 4 ) + 1, 64 * 1024, 1024 * 1024 );
+
+		std::vector< std::unique_ptr< __ndjson_chunk > > chunks;
+		while ( !json.empty() )
 		{
-			result->push_back( it );
+			chunks.clear();
+			while ( !json.empty() && chunks.size() < pool.size() * 2 )
+			{
+				chunks.push_back( std::make_unique< __ndjson_chunk >( __next_ndjson_chunk( json, size ) ) );
+			}
+
+			pool.run( chunks.size(), [&]( std::size_t i ) { __read_ndjson_chunk( *chunks[i], max_depth ); } );
+
+			for ( auto & chunk : chunks )
+			{
+				for ( auto & doc : chunk->documents )
+				{
+					callback( doc );
+				}
+
+				if ( chunk->error ) std::rethrow_exception( chunk->error );
+			}
 		}
-		return result;
 	}
-	jsonhpp::element< jsonhpp::type::object > * __make_object( std::pmr::memory_resource * resource, const std::initializer_list< value > & list )
+
+	// starts and joins its threads on every call, which shows on small inputs; pass a thread_pool to reuse them
+	template< typename F > static void read_ndjson( std::string_view json, F && callback, std::size_t threads = 0, std::uint32_t max_depth = JSONHPP_MAX_DEPTH )
 	{
-		auto result = new ( resource->allocate( sizeof( object_t ) ) ) object_t( resource );
-		for ( auto it = list.begin(); it != list.end(); it += 2 )
+		jsonhpp::thread_pool pool( std::min( __thread_count( threads ), json.size() / ( 64 * 1024 ) + 1 ) );
+
+		read_ndjson( json, std::forward< F >( callback ), pool, max_depth );
+	}
+
+	template< typename T, typename F > void __read_elements( jsonhpp::istream_wrapper< T > & stream, F && callback, jsonhpp::key_pool * pool, std::uint32_t max_depth )
+	{
+		__stream_ignore( stream );
+		if ( !__stream_check( stream, '[' ) ) JSONHPP_THROW( std::invalid_argument( "not matched \'[\'" ) );
+		if ( max_depth == 0 ) JSONHPP_THROW( std::length_error( "nesting too deep!" ) );
+
+		__stream_ignore( stream );
+		if ( __stream_check( stream, ']' ) ) return;
+
+		std::pmr::monotonic_buffer_resource arena;
+		read_stack stack;
+		while ( true )
 		{
-			result->insert( it->get_string(), *( it + 1 ) );
+			{
+				jsonhpp::document doc( &arena );
+				doc = __read_value( &arena, stream, stack, max_depth - 1, pool );
+
+				callback( doc );
+			}
+			arena.release();
+
+			__stream_ignore( stream );
+			char c = __stream_get( stream );
+			if ( c == ']' ) break;
+			if ( c != ',' ) JSONHPP_THROW( std::invalid_argument( "not matched \',\'" ) );
 		}
-		return result;
 	}
-	jsonhpp::element< jsonhpp::type::array > * __copy_array( std::pmr::memory_resource * resource, element< type::array > * copy )
+
+	template< typename T, typename F > static void read_elements( jsonhpp::istream_wrapper< T > & stream, F && callback, std::uint32_t max_depth = JSONHPP_MAX_DEPTH )
 	{
-		auto result = new ( resource->allocate( sizeof( array_t ) ) ) array_t( resource );
-		*result = *copy;
-		return result;
+		__read_elements( stream, std::forward< F >( callback ), nullptr, max_depth );
 	}
-	jsonhpp::element< jsonhpp::type::object > * __copy_object( std::pmr::memory_resource * resource, element< type::object > * copy )
+
+	// the pool outlives each element's arena, so repeated keys are stored once for the whole array
+	template< typename T, typename F > static void read_elements( jsonhpp::istream_wrapper< T > & stream, F && callback, jsonhpp::key_pool & pool, std::uint32_t max_depth = JSONHPP_MAX_DEPTH )
 	{
-		auto result = new ( resource->allocate( sizeof( object_t ) ) ) object_t( resource );
-		*result = *copy;
-		return result;
+		__read_elements( stream, std::forward< F >( callback ), &pool, max_depth );
+	}
+
+	template< typename F > static void read_elements( std::string_view json, F && callback, jsonhpp::key_pool & pool, std::uint32_t max_depth = JSONHPP_MAX_DEPTH )
+	{
+		jsonhpp::istream_wrapper< char * > wrapper( json.data(), json.size() );
+
+		read_elements( wrapper, std::forward< F >( callback ), pool, max_depth );
+	}
+
+	template< typename F > static void read_elements( std::string_view json, F && callback, std::uint32_t max_depth = JSONHPP_MAX_DEPTH )
+	{
+		jsonhpp::istream_wrapper< char * > wrapper( json.data(), json.size() );
+
+		read_elements( wrapper, std::forward< F >( callback ), max_depth );
+	}
+
+	template< typename F > static void read_elements( std::istream & stream, F && callback, std::uint32_t max_depth = JSONHPP_MAX_DEPTH )
+	{
+		jsonhpp::istream_wrapper< std::istream > wrapper( stream );
+
+		read_elements( wrapper, std::forward< F >( callback ), max_depth );
+	}
+
+	static void read( jsonhpp::document & doc, std::istream & stream, std::uint32_t max_depth = JSONHPP_MAX_DEPTH )
+	{
+		jsonhpp::istream_wrapper< std::istream > wrapper( stream );
+
+		read( doc, wrapper, max_depth );
 	}
 
-	template< typename T > static void read( jsonhpp::document & doc, jsonhpp::istream_wrapper< T > & stream )
+	// mapping only saves the istream and the intermediate buffer: the mapping is gone when this returns,
+	// so strings are copied into the document as with read, it is not a zero-copy parse
+	static void read_file( jsonhpp::document & doc, const std::filesystem::path & path, std::uint32_t max_depth = JSONHPP_MAX_DEPTH )
 	{
-		doc = __read_value( doc.resource(), stream );
+		__mapped_file file( path );
+		jsonhpp::istream_wrapper< char * > wrapper( file.data(), file.size() );
+
+		read( doc, wrapper, max_depth );
 	}
 
-	template< typename T > static void write( const jsonhpp::document & doc, jsonhpp::ostream_wrapper< T > & stream, std::uint32_t tab = 0 )
+	template< typename A > static void read( jsonhpp::document & doc, const std::basic_string< char, std::char_traits< char >, A > & str, std::uint32_t max_depth = JSONHPP_MAX_DEPTH )
 	{
-		__write_value( doc, stream, 0, tab );
+		jsonhpp::istream_wrapper< std::basic_string< char, std::char_traits< char >, A > > wrapper( str );
+
+		read( doc, wrapper, max_depth );
 	}
 
+	template< typename T, typename H > static bool parse_events( jsonhpp::istream_wrapper< T > & stream, H && handler, std::uint32_t max_depth = JSONHPP_MAX_DEPTH )
+	{
+		return __parse_events( stream, handler, max_depth );
+	}
 
-	static void read( jsonhpp::document & doc, const char * json )
+	template< typename H > static bool parse_events( const char * json, H && handler, std::uint32_t max_depth = JSONHPP_MAX_DEPTH )
 	{
 		jsonhpp::istream_wrapper< char * > wrapper( json, std::strlen( json ) );
 
-		read( doc, wrapper );
+		return parse_events( wrapper, handler, max_depth );
 	}
 
-	static void read( jsonhpp::document & doc, std::string_view json )
+	template< typename H > static bool parse_events( std::string_view json, H && handler, std::uint32_t max_depth = JSONHPP_MAX_DEPTH )
 	{
 		jsonhpp::istream_wrapper< char * > wrapper( json.data(), json.size() );
 
-		read( doc, wrapper );
+		return parse_events( wrapper, handler, max_depth );
 	}
 
-	static void read( jsonhpp::document & doc, std::istream & stream )
+	template< typename H > static bool parse_events( std::istream & stream, H && handler, std::uint32_t max_depth = JSONHPP_MAX_DEPTH )
 	{
 		jsonhpp::istream_wrapper< std::istream > wrapper( stream );
 
-		read( doc, wrapper );
+		return parse_events( wrapper, handler, max_depth );
 	}
 
-	template< typename A > static void read( jsonhpp::document & doc, const std::basic_string< char, std::char_traits< char >, A > & str )
+	template< typename A, typename H > static bool parse_events( const std::basic_string< char, std::char_traits< char >, A > & str, H && handler, std::uint32_t max_depth = JSONHPP_MAX_DEPTH )
 	{
 		jsonhpp::istream_wrapper< std::basic_string< char, std::char_traits< char >, A > > wrapper( str );
 
-		read( doc, wrapper );
+		return parse_events( wrapper, handler, max_depth );
 	}
 
-	static void write( const jsonhpp::document & doc, std::ostream & stream, std::uint32_t tab = 0 )
+	static void write( const jsonhpp::document & doc, std::ostream & stream, std::uint32_t tab = 0, bool ascii = false )
 	{
 		jsonhpp::ostream_wrapper< std::ostream > wrapper( stream );
 
-		write( doc, wrapper, tab );
+		write( doc, wrapper, tab, ascii );
 	}
 
-	static void write( const jsonhpp::document & doc, char * data, std::size_t size, std::uint32_t tab = 0 )
+	static void write( const jsonhpp::document & doc, char * data, std::size_t size, std::uint32_t tab = 0, bool ascii = false )
 	{
 		jsonhpp::ostream_wrapper< char * > wrapper( data, size );
 
-		write( doc, wrapper, tab );
+		write( doc, wrapper, tab, ascii );
+		if ( !wrapper.status() ) JSONHPP_THROW( std::invalid_argument( wrapper.status().what() ) );
+		if ( wrapper.overflow() ) JSONHPP_THROW( std::out_of_range( "out of range" ) );
 	}
 
-	template< typename A > static void write( const jsonhpp::document & doc, std::basic_string< char, std::char_traits< char >, A > & str, std::uint32_t tab = 0 )
+	template< typename A > static void write( const jsonhpp::document & doc, std::basic_string< char, std::char_traits< char >, A > & str, std::uint32_t tab = 0, bool ascii = false )
 	{
 		jsonhpp::ostream_wrapper< std::basic_string< char, std::char_traits< char >, A > > wrapper( str );
 
-		write( doc, wrapper, tab );
+		write( doc, wrapper, tab, ascii );
 	}
 
 }
@@ -1,9 +1,27 @@
+#include <fstream>
 #include <iostream>
 
 #include "json.hpp"
 
 using namespace std;
 
+static int failures = 0;
+
+static void check( bool ok, const char * what )
+{
+	if ( ok ) return;
+
+	std::cerr << "FAILED: " << what << std::endl;
+	++failures;
+}
+
+static std::string to_string( const jsonhpp::document & doc )
+{
+	std::string str;
+	jsonhpp::write( doc, str );
+	return str;
+}
+
 int main()
 {
 	const char * json = R"(
@@ -83,5 +101,204 @@ int main()
 		std::cout << std::endl;
 	}
 
-	return 0;
+	{
+		std::string array = "[";
+		std::string object = "{";
+		for ( int i = 0; i < 20000; i++ )
+		{
+			std::string item = "{\"id\":" + std::to_string( i ) + ",\"name\":\"item " + std::to_string( i ) + "\",\"tags\":[1,2.5,true,null]}";
+			array += ( i ? "," : "" ) + item;
+			object += ( i ? ",\"k" : "\"k" ) + std::to_string( i ) + "\":" + item;
+		}
+		array += "]";
+		object += "}";
+
+		for ( const std::string * json : { &array, &object } )
+		{
+			jsonhpp::document expected;
+			jsonhpp::read( expected, *json );
+
+			jsonhpp::document doc;
+			jsonhpp::read_parallel( doc, *json, 4 );
+			check( to_string( doc ) == to_string( expected ), "read_parallel matches read" );
+
+			jsonhpp::document arena( jsonhpp::arena );
+			jsonhpp::read_parallel( arena, *json, 4 );
+			check( to_string( arena ) == to_string( expected ), "read_parallel into an arena matches read" );
+		}
+
+		// values taken out of a parallel read must not depend on the document afterwards
+		jsonhpp::document doc;
+		jsonhpp::read_parallel( doc, array, 4 );
+
+		jsonhpp::value keep = doc[7];
+		jsonhpp::value moved = std::move( doc[8] );
+		doc = 5;
+
+		check( keep["name"].get_string() == "item 7" && keep["tags"].get_array().size() == 4, "copy survives reassigning the document" );
+		check( moved["name"].get_string() == "item 8" && moved["tags"].get_array().size() == 4, "moved value survives reassigning the document" );
+	}
+
+	{
+		jsonhpp::document doc = { "ok", "caf\xc3\xa9", "bad", "\xff" };
+
+		char buffer[64];
+		std::size_t written = 0;
+		jsonhpp::result result = jsonhpp::try_write( doc, buffer, sizeof( buffer ), written, 0, true );
+		check( result.error == jsonhpp::error::invalid_utf8, "try_write reports invalid utf-8 when escaping to ascii" );
+
+		jsonhpp::document good = { "ok", "caf\xc3\xa9" };
+		result = jsonhpp::try_write( good, buffer, sizeof( buffer ), written, 0, true );
+		check( result && std::string( buffer, written ) == "{\"ok\":\"caf\\u00e9\"}", "try_write escapes valid utf-8 to ascii" );
+
+		result = jsonhpp::try_write( good, buffer, 4, written );
+		check( result.error == jsonhpp::error::buffer_too_small, "try_write reports a small buffer" );
+	}
+
+	{
+		struct
+		{
+			const char * json;
+			jsonhpp::error error;
+		} cases[] = {
+			{ "[1, 2", jsonhpp::error::unexpected_end },
+			{ "[1, 2] x", jsonhpp::error::trailing_characters },
+			{ "{\"a\" 1}", jsonhpp::error::unexpected_character },
+			{ "[01]", jsonhpp::error::invalid_number },
+			{ "\"a\tb\"", jsonhpp::error::invalid_string },
+			{ "\"\\q\"", jsonhpp::error::invalid_escape },
+			{ "\"\\ud800\"", jsonhpp::error::invalid_unicode },
+			{ "\"\xff\"", jsonhpp::error::invalid_utf8 },
+			{ "[[[[1]]]]", jsonhpp::error::depth_exceeded },
+		};
+
+		for ( const auto & item : cases )
+		{
+			jsonhpp::document doc = { 1, 2, 3 };
+			jsonhpp::result result = jsonhpp::try_read( doc, item.json, 3 );
+			check( result.error == item.error, item.json );
+			check( to_string( doc ) == "[1,2,3]", "try_read leaves the document alone on failure" );
+		}
+
+		jsonhpp::document doc;
+		check( jsonhpp::try_read( doc, std::string_view( "{\"a\":[true]}" ) ) && to_string( doc ) == "{\"a\":[true]}", "try_read accepts valid input" );
+	}
+
+	{
+		jsonhpp::value copy = nullptr;
+		{
+			jsonhpp::document doc( jsonhpp::arena );
+			jsonhpp::read( doc, R"({"k":{"name":"value","list":[1,2,3]}})" );
+
+			copy = doc["k"];
+			jsonhpp::value direct = doc["k"];
+			check( direct.resource() == std::pmr::get_default_resource(), "copies out of an arena document use the default resource" );
+
+			doc.reset();
+			check( direct["name"].get_string() == "value" && direct["list"].get_array().size() == 3, "copy survives reset()" );
+		}
+		check( copy["name"].get_string() == "value" && copy["list"].get_array().size() == 3, "copy survives the arena document" );
+	}
+
+	{
+		std::string lines;
+		for ( int i = 0; i < 30000; i++ )
+		{
+			lines += "{\"line\":" + std::to_string( i ) + ",\"text\":\"some padding to spread lines over chunks\"}\n";
+			if ( i % 1000 == 0 ) lines += "\n";
+		}
+
+		jsonhpp::ndjson_batch batch;
+		jsonhpp::read_ndjson( batch, lines, 4 );
+
+		bool ordered = ( batch.size() == 30000 );
+		for ( std::size_t i = 0; ordered && i < batch.size(); i++ )
+		{
+			ordered = ( static_cast< std::int64_t >( batch[i]["line"].get_number() ) == static_cast< std::int64_t >( i ) );
+		}
+		check( ordered, "read_ndjson keeps line order and skips blank lines" );
+
+		std::int64_t next = 0;
+		jsonhpp::read_ndjson( lines, [&]( jsonhpp::document & doc ) { ordered = ordered && static_cast< std::int64_t >( doc["line"].get_number() ) == next++; }, 4 );
+		check( ordered && next == 30000, "read_ndjson callback sees lines in order" );
+
+		std::string broken = lines + "{\"line\":\n" + lines;
+
+		bool thrown = false;
+		try
+		{
+			jsonhpp::read_ndjson( batch, broken, 4 );
+		}
+		catch ( const std::invalid_argument & )
+		{
+			thrown = true;
+		}
+		check( thrown && batch.empty(), "read_ndjson rejects a broken line and leaves the batch empty" );
+
+		thrown = false;
+		next = 0;
+		try
+		{
+			jsonhpp::read_ndjson( broken, [&]( const jsonhpp::document & ) { ++next; }, 4 );
+		}
+		catch ( const std::invalid_argument & )
+		{
+			thrown = true;
+		}
+		check( thrown && next == 30000, "read_ndjson callback stops at the broken line" );
+
+		jsonhpp::thread_pool pool( 4 );
+		for ( int i = 0; i < 3; i++ )
+		{
+			jsonhpp::read_ndjson( batch, lines, pool );
+			check( batch.size() == 30000 && static_cast< std::int64_t >( batch[29999]["line"].get_number() ) == 29999, "read_ndjson reuses a thread_pool" );
+		}
+	}
+
+	{
+		std::filesystem::path path = std::filesystem::temp_directory_path() / "jsonhpp_read_file.json";
+		{
+			std::ofstream file( path, std::ios::binary );
+			file << R"({"name":"file","list":[1,2,3]})";
+		}
+
+		jsonhpp::document doc;
+		jsonhpp::read_file( doc, path );
+		std::filesystem::remove( path );
+
+		check( to_string( doc ) == R"({"name":"file","list":[1,2,3]})", "read_file keeps its strings after the mapping is released" );
+	}
+
+	{
+		// like a pipe: no seeking, so tellp() fails
+		struct unseekable : std::streambuf
+		{
+			std::string data;
+
+			int_type overflow( int_type c ) override
+			{
+				if ( c != traits_type::eof() ) data.push_back( traits_type::to_char_type( c ) );
+				return c;
+			}
+
+			std::streamsize xsputn( const char * s, std::streamsize n ) override
+			{
+				data.append( s, n );
+				return n;
+			}
+		} buffer;
+		std::ostream stream( &buffer );
+
+		jsonhpp::document doc = { "name", "a string longer than the buffer", "list", { 1, 2, 3 } };
+		std::string expected = to_string( doc );
+
+		jsonhpp::ostream_wrapper< std::ostream > wrapper( stream, 16 );
+		jsonhpp::write( doc, wrapper );
+		check( wrapper.size() == expected.size(), "ostream_wrapper counts bytes on an unseekable stream" );
+
+		wrapper.flush();
+		check( wrapper.size() == expected.size() && buffer.data == expected, "ostream_wrapper size is unchanged by flush" );
+	}
+
+	return failures == 0 ? 0 : 1;
 }